@@ -0,0 +1,175 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "AugmentaCrowdVisualizerComponent.h"
+
+#include "LiveLinkAugmenta.h"
+#include "LiveLinkAugmentaEventDispatcher.h"
+
+UAugmentaCrowdVisualizerComponent::UAugmentaCrowdVisualizerComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	AugmentaEventDispatcher = nullptr;
+
+	SetMobility(EComponentMobility::Movable);
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetCanEverAffectNavigation(false);
+}
+
+void UAugmentaCrowdVisualizerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!AugmentaEventDispatcher)
+	{
+		AugmentaEventDispatcher = Cast<ALiveLinkAugmentaEventDispatcher>(GetOwner());
+	}
+
+	BindToDispatcher();
+}
+
+void UAugmentaCrowdVisualizerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindFromDispatcher();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAugmentaCrowdVisualizerComponent::SetAugmentaEventDispatcher(ALiveLinkAugmentaEventDispatcher* NewAugmentaEventDispatcher)
+{
+	UnbindFromDispatcher();
+
+	AugmentaEventDispatcher = NewAugmentaEventDispatcher;
+
+	if (HasBegunPlay())
+	{
+		BindToDispatcher();
+	}
+}
+
+void UAugmentaCrowdVisualizerComponent::BindToDispatcher()
+{
+	if (!AugmentaEventDispatcher)
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("AugmentaCrowdVisualizerComponent: No Augmenta Event Dispatcher to visualize on %s."), *GetOwner()->GetName());
+		return;
+	}
+
+	AugmentaEventDispatcher->OnAugmentaFrameNative.AddUObject(this, &UAugmentaCrowdVisualizerComponent::OnAugmentaFrame);
+	AugmentaEventDispatcher->OnAugmentaSourceDestroyedNative.AddUObject(this, &UAugmentaCrowdVisualizerComponent::OnAugmentaSourceDestroyed);
+	BoundDispatcher = AugmentaEventDispatcher;
+
+	//Show the objects already present
+	for (const TPair<int, FLiveLinkAugmentaObject>& TrackedObject : AugmentaEventDispatcher->GetTrackedAugmentaObjects())
+	{
+		ShowObject(TrackedObject.Value);
+	}
+
+	FlushInstanceTransforms();
+}
+
+void UAugmentaCrowdVisualizerComponent::UnbindFromDispatcher()
+{
+	if (ALiveLinkAugmentaEventDispatcher* Dispatcher = BoundDispatcher.Get())
+	{
+		Dispatcher->OnAugmentaFrameNative.RemoveAll(this);
+		Dispatcher->OnAugmentaSourceDestroyedNative.RemoveAll(this);
+	}
+
+	BoundDispatcher.Reset();
+
+	OnAugmentaSourceDestroyed();
+}
+
+void UAugmentaCrowdVisualizerComponent::OnAugmentaFrame(const TArray<FLiveLinkAugmentaObject>& EnteredObjects, const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects)
+{
+	for (const FLiveLinkAugmentaObject& AugmentaObject : LeftObjects)
+	{
+		HideObject(AugmentaObject.Id);
+	}
+
+	//An object entering and leaving during the frame is in both arrays, as is an object leaving and coming back.
+	//The dispatcher tracks the objects present at the end of the frame, only those are shown.
+	const ALiveLinkAugmentaEventDispatcher* Dispatcher = LeftObjects.Num() > 0 ? BoundDispatcher.Get() : nullptr;
+
+	for (const FLiveLinkAugmentaObject& AugmentaObject : EnteredObjects)
+	{
+		if (!Dispatcher || Dispatcher->FindTrackedAugmentaObject(AugmentaObject.Id))
+		{
+			ShowObject(AugmentaObject);
+		}
+	}
+
+	for (const FLiveLinkAugmentaObject& AugmentaObject : UpdatedObjects)
+	{
+		if (!Dispatcher || Dispatcher->FindTrackedAugmentaObject(AugmentaObject.Id))
+		{
+			ShowObject(AugmentaObject);
+		}
+	}
+
+	FlushInstanceTransforms();
+}
+
+void UAugmentaCrowdVisualizerComponent::OnAugmentaSourceDestroyed()
+{
+	for (const TPair<int, int32>& ObjectInstance : ObjectIdToInstance)
+	{
+		InstanceTransforms[ObjectInstance.Value].SetScale3D(FVector::ZeroVector);
+		FreeInstances.Add(ObjectInstance.Value);
+	}
+
+	ObjectIdToInstance.Reset();
+
+	FlushInstanceTransforms();
+}
+
+void UAugmentaCrowdVisualizerComponent::ShowObject(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	int32& InstanceIndex = ObjectIdToInstance.FindOrAdd(AugmentaObject.Id, INDEX_NONE);
+
+	if (InstanceIndex == INDEX_NONE)
+	{
+		//Reuse a hidden instance when possible
+		InstanceIndex = FreeInstances.Num() > 0 ? FreeInstances.Pop(EAllowShrinking::No) : InstanceTransforms.AddDefaulted();
+	}
+
+	InstanceTransforms[InstanceIndex] = GetInstanceTransform(AugmentaObject);
+}
+
+void UAugmentaCrowdVisualizerComponent::HideObject(int Id)
+{
+	int32 InstanceIndex;
+	if (ObjectIdToInstance.RemoveAndCopyValue(Id, InstanceIndex))
+	{
+		InstanceTransforms[InstanceIndex].SetScale3D(FVector::ZeroVector);
+		FreeInstances.Add(InstanceIndex);
+	}
+}
+
+void UAugmentaCrowdVisualizerComponent::FlushInstanceTransforms()
+{
+	const int32 InstanceCount = GetInstanceCount();
+
+	if (InstanceTransforms.Num() == 0)
+	{
+		return;
+	}
+
+	//Create the instances needed by the new objects, their transforms are part of the bulk update below
+	if (InstanceTransforms.Num() > InstanceCount)
+	{
+		TArray<FTransform> NewInstanceTransforms(&InstanceTransforms[InstanceCount], InstanceTransforms.Num() - InstanceCount);
+		AddInstances(NewInstanceTransforms, false, false);
+	}
+
+	BatchUpdateInstancesTransforms(0, InstanceTransforms, false, true, true);
+}
+
+FTransform UAugmentaCrowdVisualizerComponent::GetInstanceTransform(const FLiveLinkAugmentaObject& AugmentaObject) const
+{
+	const FVector Scale = bApplyObjectScale ? AugmentaObject.Scale * InstanceScale : InstanceScale;
+
+	return FTransform(AugmentaObject.Rotation, AugmentaObject.Position, Scale);
+}
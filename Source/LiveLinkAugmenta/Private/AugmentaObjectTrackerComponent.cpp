@@ -0,0 +1,176 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "AugmentaObjectTrackerComponent.h"
+
+#include "LiveLinkAugmenta.h"
+
+UAugmentaObjectTrackerComponent::UAugmentaObjectTrackerComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	AugmentaEventDispatcher = nullptr;
+}
+
+void UAugmentaObjectTrackerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!AugmentaEventDispatcher)
+	{
+		AugmentaEventDispatcher = Cast<ALiveLinkAugmentaEventDispatcher>(GetOwner());
+	}
+
+	if (!AugmentaEventDispatcher)
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("AugmentaObjectTrackerComponent: No Augmenta Event Dispatcher to track objects from on %s."), *GetOwner()->GetName());
+		return;
+	}
+
+	BoundDispatcher = AugmentaEventDispatcher;
+	FrameHandle = AugmentaEventDispatcher->OnAugmentaFrameNative.AddUObject(this, &UAugmentaObjectTrackerComponent::OnAugmentaFrame);
+	SourceDestroyedHandle = AugmentaEventDispatcher->OnAugmentaSourceDestroyedNative.AddUObject(this, &UAugmentaObjectTrackerComponent::OnAugmentaSourceDestroyed);
+
+	if (TrackingMode == EAugmentaObjectTrackingMode::ObjectId)
+	{
+		SetSubscribedObject(TrackedObjectId);
+	}
+	else
+	{
+		TrackNearestToPoint(TrackingPoint, MaxDistance);
+	}
+}
+
+void UAugmentaObjectTrackerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Unsubscribe();
+
+	if (ALiveLinkAugmentaEventDispatcher* Dispatcher = BoundDispatcher.Get())
+	{
+		Dispatcher->OnAugmentaFrameNative.Remove(FrameHandle);
+		Dispatcher->OnAugmentaSourceDestroyedNative.Remove(SourceDestroyedHandle);
+	}
+
+	BoundDispatcher.Reset();
+	FrameHandle.Reset();
+	SourceDestroyedHandle.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAugmentaObjectTrackerComponent::TrackObjectId(int Id)
+{
+	TrackingMode = EAugmentaObjectTrackingMode::ObjectId;
+	TrackedObjectId = Id;
+
+	SetSubscribedObject(Id);
+}
+
+void UAugmentaObjectTrackerComponent::TrackNearestToPoint(FVector Point, float InMaxDistance)
+{
+	TrackingMode = EAugmentaObjectTrackingMode::NearestToPoint;
+	TrackingPoint = Point;
+	MaxDistance = InMaxDistance;
+
+	if (const ALiveLinkAugmentaEventDispatcher* Dispatcher = BoundDispatcher.Get())
+	{
+		SetSubscribedObject(Dispatcher->GetSpatialIndex().FindNearest(FVector2D(TrackingPoint), MaxDistance > 0 ? MaxDistance : UE_BIG_NUMBER));
+	}
+}
+
+bool UAugmentaObjectTrackerComponent::GetTrackedObject(FLiveLinkAugmentaObject& AugmentaObject) const
+{
+	const ALiveLinkAugmentaEventDispatcher* Dispatcher = BoundDispatcher.Get();
+
+	if (const FLiveLinkAugmentaObject* TrackedObject = Dispatcher ? Dispatcher->FindTrackedAugmentaObject(SubscribedObjectId) : nullptr)
+	{
+		AugmentaObject = *TrackedObject;
+		return true;
+	}
+
+	return false;
+}
+
+void UAugmentaObjectTrackerComponent::OnTrackedObjectEvent(const FLiveLinkAugmentaObject& AugmentaObject, EAugmentaLifecycleFlags Event)
+{
+	switch (Event)
+	{
+	case EAugmentaLifecycleFlags::Entered:
+		OnTrackedObjectEntered.Broadcast(AugmentaObject);
+		break;
+
+	case EAugmentaLifecycleFlags::Updated:
+		OnTrackedObjectUpdated.Broadcast(AugmentaObject);
+		break;
+
+	case EAugmentaLifecycleFlags::Left:
+		OnTrackedObjectLeft.Broadcast(AugmentaObject);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UAugmentaObjectTrackerComponent::OnAugmentaFrame(const TArray<FLiveLinkAugmentaObject>& EnteredObjects, const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects)
+{
+	//The nearest object can only change once the whole frame has been applied
+	if (TrackingMode == EAugmentaObjectTrackingMode::NearestToPoint)
+	{
+		TrackNearestToPoint(TrackingPoint, MaxDistance);
+	}
+}
+
+void UAugmentaObjectTrackerComponent::OnAugmentaSourceDestroyed()
+{
+	//The tracked object already fired its left event through the subscription.
+	//In ObjectId mode the subscription is kept for the same Id from the next source.
+	if (TrackingMode == EAugmentaObjectTrackingMode::NearestToPoint)
+	{
+		TrackNearestToPoint(TrackingPoint, MaxDistance);
+	}
+}
+
+void UAugmentaObjectTrackerComponent::SetSubscribedObject(int Id)
+{
+	ALiveLinkAugmentaEventDispatcher* Dispatcher = BoundDispatcher.Get();
+
+	if (!Dispatcher || Id == SubscribedObjectId)
+	{
+		return;
+	}
+
+	//Objects that left already fired their left event through the subscription
+	if (const FLiveLinkAugmentaObject* PreviousObject = Dispatcher->FindTrackedAugmentaObject(SubscribedObjectId))
+	{
+		OnTrackedObjectLeft.Broadcast(*PreviousObject);
+	}
+
+	Unsubscribe();
+
+	if (Id == INDEX_NONE)
+	{
+		return;
+	}
+
+	SubscribedObjectId = Id;
+	SubscriptionHandle = Dispatcher->SubscribeToAugmentaObject(Id, FAugmentaObjectSubscriptionNativeEvent::FDelegate::CreateUObject(this, &UAugmentaObjectTrackerComponent::OnTrackedObjectEvent));
+
+	if (const FLiveLinkAugmentaObject* NewObject = Dispatcher->FindTrackedAugmentaObject(Id))
+	{
+		OnTrackedObjectEntered.Broadcast(*NewObject);
+	}
+}
+
+void UAugmentaObjectTrackerComponent::Unsubscribe()
+{
+	if (ALiveLinkAugmentaEventDispatcher* Dispatcher = BoundDispatcher.Get())
+	{
+		if (SubscribedObjectId != INDEX_NONE)
+		{
+			Dispatcher->UnsubscribeFromAugmentaObject(SubscribedObjectId, SubscriptionHandle);
+		}
+	}
+
+	SubscribedObjectId = INDEX_NONE;
+	SubscriptionHandle.Reset();
+}
@@ -0,0 +1,265 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+
+#include "LiveLinkAugmentaActorPool.h"
+
+#include "LiveLinkAugmenta.h"
+#include "LiveLinkAugmentaEventDispatcher.h"
+
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+
+ALiveLinkAugmentaActorPool::ALiveLinkAugmentaActorPool()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+	AugmentaEventDispatcher = nullptr;
+}
+
+void ALiveLinkAugmentaActorPool::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!PooledActorClass)
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaActorPool: No pooled actor class set on %s."), *GetName());
+		return;
+	}
+
+	//Fill the pool
+	InactiveActors.Reserve(PoolSize);
+	for (int i = 0; i < PoolSize; i++)
+	{
+		if (AActor* Actor = SpawnPooledActor())
+		{
+			InactiveActors.Add(Actor);
+		}
+	}
+
+	if (!AugmentaEventDispatcher)
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaActorPool: No Augmenta Event Dispatcher set on %s."), *GetName());
+		return;
+	}
+
+	AugmentaEventDispatcher->OnAugmentaObjectEnteredNative.AddUObject(this, &ALiveLinkAugmentaActorPool::OnAugmentaObjectEntered);
+	AugmentaEventDispatcher->OnAugmentaObjectUpdatedNative.AddUObject(this, &ALiveLinkAugmentaActorPool::OnAugmentaObjectUpdated);
+	AugmentaEventDispatcher->OnAugmentaObjectLeftNative.AddUObject(this, &ALiveLinkAugmentaActorPool::OnAugmentaObjectLeft);
+	AugmentaEventDispatcher->OnAugmentaSourceDestroyedNative.AddUObject(this, &ALiveLinkAugmentaActorPool::OnAugmentaSourceDestroyed);
+	BoundDispatcher = AugmentaEventDispatcher;
+
+	//Give an actor to the objects already present
+	for (const TPair<int, FLiveLinkAugmentaObject>& TrackedObject : AugmentaEventDispatcher->GetTrackedAugmentaObjects())
+	{
+		OnAugmentaObjectEntered(TrackedObject.Value);
+	}
+}
+
+void ALiveLinkAugmentaActorPool::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ALiveLinkAugmentaEventDispatcher* Dispatcher = BoundDispatcher.Get())
+	{
+		Dispatcher->OnAugmentaObjectEnteredNative.RemoveAll(this);
+		Dispatcher->OnAugmentaObjectUpdatedNative.RemoveAll(this);
+		Dispatcher->OnAugmentaObjectLeftNative.RemoveAll(this);
+		Dispatcher->OnAugmentaSourceDestroyedNative.RemoveAll(this);
+	}
+
+	BoundDispatcher.Reset();
+
+	//The pool owns its actors
+	for (const TPair<int, AActor*>& ActiveActor : ActiveActors)
+	{
+		if (IsValid(ActiveActor.Value))
+		{
+			ActiveActor.Value->Destroy();
+		}
+	}
+
+	for (AActor* Actor : InactiveActors)
+	{
+		if (IsValid(Actor))
+		{
+			Actor->Destroy();
+		}
+	}
+
+	ActiveActors.Empty();
+	InactiveActors.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+AActor* ALiveLinkAugmentaActorPool::GetActorForAugmentaObject(int Id) const
+{
+	AActor* const* Actor = ActiveActors.Find(Id);
+
+	return Actor ? *Actor : nullptr;
+}
+
+void ALiveLinkAugmentaActorPool::OnAugmentaObjectEntered(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	if (ActiveActors.Contains(AugmentaObject.Id))
+	{
+		OnAugmentaObjectUpdated(AugmentaObject);
+		return;
+	}
+
+	AActor* Actor = nullptr;
+
+	//Skip the actors destroyed by someone else
+	while (InactiveActors.Num() > 0 && !IsValid(Actor))
+	{
+		Actor = InactiveActors.Pop(EAllowShrinking::No);
+	}
+
+	if (IsValid(Actor))
+	{
+		PoolHits++;
+	}
+	else
+	{
+		PoolMisses++;
+
+		if (!bGrowPool)
+		{
+			return;
+		}
+
+		Actor = SpawnPooledActor();
+
+		if (!Actor)
+		{
+			return;
+		}
+	}
+
+	ActiveActors.Add(AugmentaObject.Id, Actor);
+	ActivateActor(Actor, AugmentaObject);
+}
+
+void ALiveLinkAugmentaActorPool::OnAugmentaObjectUpdated(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	AActor* const* Actor = ActiveActors.Find(AugmentaObject.Id);
+
+	//The enter event was missed or the pool was empty, try again
+	if (!Actor)
+	{
+		if (bGrowPool || InactiveActors.Num() > 0)
+		{
+			OnAugmentaObjectEntered(AugmentaObject);
+		}
+		return;
+	}
+
+	if (!IsValid(*Actor))
+	{
+		ActiveActors.Remove(AugmentaObject.Id);
+		return;
+	}
+
+	if (bUpdateActorTransforms)
+	{
+		UpdateActorTransform(*Actor, AugmentaObject);
+	}
+
+	if ((*Actor)->Implements<UAugmentaPooledActor>())
+	{
+		IAugmentaPooledActor::Execute_OnAugmentaObjectUpdated(*Actor, AugmentaObject);
+	}
+}
+
+void ALiveLinkAugmentaActorPool::OnAugmentaObjectLeft(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	AActor* Actor;
+	if (!ActiveActors.RemoveAndCopyValue(AugmentaObject.Id, Actor) || !IsValid(Actor))
+	{
+		return;
+	}
+
+	DeactivateActor(Actor, AugmentaObject);
+	InactiveActors.Add(Actor);
+}
+
+void ALiveLinkAugmentaActorPool::OnAugmentaSourceDestroyed()
+{
+	for (const TPair<int, AActor*>& ActiveActor : ActiveActors)
+	{
+		if (IsValid(ActiveActor.Value))
+		{
+			FLiveLinkAugmentaObject AugmentaObject;
+			AugmentaObject.Id = ActiveActor.Key;
+
+			DeactivateActor(ActiveActor.Value, AugmentaObject);
+			InactiveActors.Add(ActiveActor.Value);
+		}
+	}
+
+	ActiveActors.Reset();
+}
+
+AActor* ALiveLinkAugmentaActorPool::SpawnPooledActor()
+{
+	UWorld* World = GetWorld();
+
+	if (!World || !PooledActorClass)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Owner = this;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Actor = World->SpawnActor<AActor>(PooledActorClass, GetActorTransform(), SpawnParameters);
+
+	if (!Actor)
+	{
+		UE_LOG(LogLiveLinkAugmenta, Error, TEXT("LiveLinkAugmentaActorPool: Could not spawn actor of class %s."), *PooledActorClass->GetName());
+		return nullptr;
+	}
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	return Actor;
+}
+
+void ALiveLinkAugmentaActorPool::ActivateActor(AActor* Actor, const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	if (bUpdateActorTransforms)
+	{
+		UpdateActorTransform(Actor, AugmentaObject);
+	}
+
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorEnableCollision(true);
+	Actor->SetActorTickEnabled(true);
+
+	if (Actor->Implements<UAugmentaPooledActor>())
+	{
+		IAugmentaPooledActor::Execute_OnAugmentaObjectActivated(Actor, AugmentaObject);
+	}
+}
+
+void ALiveLinkAugmentaActorPool::DeactivateActor(AActor* Actor, const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	if (Actor->Implements<UAugmentaPooledActor>())
+	{
+		IAugmentaPooledActor::Execute_OnAugmentaObjectDeactivated(Actor, AugmentaObject);
+	}
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+}
+
+void ALiveLinkAugmentaActorPool::UpdateActorTransform(AActor* Actor, const FLiveLinkAugmentaObject& AugmentaObject) const
+{
+	const FTransform ObjectTransform(AugmentaObject.Rotation, AugmentaObject.Position);
+
+	Actor->SetActorTransform(ObjectTransform * GetActorTransform(), false, nullptr, ETeleportType::TeleportPhysics);
+}
@@ -0,0 +1,469 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaClusterCodec.h"
+#include "LiveLinkAugmentaSchema.h"
+
+#include "Math/Float16.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Writer
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+void FLiveLinkAugmentaClusterWriter::WriteUInt16(uint16 Value)
+{
+	Buffer.Add((uint8)Value);
+	Buffer.Add((uint8)(Value >> 8));
+}
+
+void FLiveLinkAugmentaClusterWriter::WriteUInt32(uint32 Value)
+{
+	WriteUInt16((uint16)Value);
+	WriteUInt16((uint16)(Value >> 16));
+}
+
+void FLiveLinkAugmentaClusterWriter::WriteUInt64(uint64 Value)
+{
+	WriteUInt32((uint32)Value);
+	WriteUInt32((uint32)(Value >> 32));
+}
+
+void FLiveLinkAugmentaClusterWriter::WriteFloat(float Value)
+{
+	uint32 Bits;
+	FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+	WriteUInt32(Bits);
+}
+
+void FLiveLinkAugmentaClusterWriter::WriteVarUInt(uint32 Value)
+{
+	while (Value >= 0x80)
+	{
+		Buffer.Add((uint8)(Value | 0x80));
+		Value >>= 7;
+	}
+
+	Buffer.Add((uint8)Value);
+}
+
+void FLiveLinkAugmentaClusterWriter::WriteVarInt(int32 Value)
+{
+	WriteVarUInt(((uint32)Value << 1) ^ (uint32)(Value >> 31));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Reader
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FLiveLinkAugmentaClusterReader::CanRead(int32 Size)
+{
+	if (bError || Num - Offset < Size)
+	{
+		bError = true;
+		return false;
+	}
+
+	return true;
+}
+
+uint8 FLiveLinkAugmentaClusterReader::ReadUInt8()
+{
+	return CanRead(1) ? Data[Offset++] : 0;
+}
+
+const uint8* FLiveLinkAugmentaClusterReader::ReadBytes(int32 Count)
+{
+	if (Count < 0 || !CanRead(Count))
+	{
+		bError = true;
+		return nullptr;
+	}
+
+	const uint8* Bytes = Data + Offset;
+	Offset += Count;
+	return Bytes;
+}
+
+uint16 FLiveLinkAugmentaClusterReader::ReadUInt16()
+{
+	if (!CanRead(2))
+	{
+		return 0;
+	}
+
+	const uint16 Value = (uint16)Data[Offset] | ((uint16)Data[Offset + 1] << 8);
+	Offset += 2;
+	return Value;
+}
+
+uint32 FLiveLinkAugmentaClusterReader::ReadUInt32()
+{
+	const uint32 Low = ReadUInt16();
+	return Low | ((uint32)ReadUInt16() << 16);
+}
+
+uint64 FLiveLinkAugmentaClusterReader::ReadUInt64()
+{
+	const uint64 Low = ReadUInt32();
+	return Low | ((uint64)ReadUInt32() << 32);
+}
+
+float FLiveLinkAugmentaClusterReader::ReadFloat()
+{
+	const uint32 Bits = ReadUInt32();
+	float Value;
+	FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+	return Value;
+}
+
+uint32 FLiveLinkAugmentaClusterReader::ReadVarUInt()
+{
+	uint32 Value = 0;
+
+	for (int32 Shift = 0; Shift < 35; Shift += 7)
+	{
+		const uint8 Byte = ReadUInt8();
+		Value |= (uint32)(Byte & 0x7F) << Shift;
+
+		if (!(Byte & 0x80))
+		{
+			return Value;
+		}
+	}
+
+	//More than 5 bytes can not be a 32 bit value
+	bError = true;
+	return 0;
+}
+
+int32 FLiveLinkAugmentaClusterReader::ReadVarInt()
+{
+	const uint32 Value = ReadVarUInt();
+	return (int32)(Value >> 1) ^ -(int32)(Value & 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Quantization
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+FLiveLinkAugmentaClusterQuantization FLiveLinkAugmentaClusterQuantization::FromScene(const FLiveLinkAugmentaScene& AugmentaScene)
+{
+	//Scene size is in meters, X and Y are swapped in Unreal space
+	const float MetersToUnrealUnits = 100.0f;
+
+	FLiveLinkAugmentaClusterQuantization Quantization;
+	Quantization.Origin = AugmentaScene.Position;
+
+	if (AugmentaScene.Size.X > 0 && AugmentaScene.Size.Y > 0)
+	{
+		Quantization.HalfRange = FVector(AugmentaScene.Size.Y * MetersToUnrealUnits, AugmentaScene.Size.X * MetersToUnrealUnits, HeightHalfRange);
+	}
+
+	return Quantization;
+}
+
+int16 FLiveLinkAugmentaClusterQuantization::Quantize(double Value, int32 Axis) const
+{
+	const double Normalized = FMath::Clamp((Value - Origin[Axis]) / HalfRange[Axis], -1.0, 1.0);
+	return (int16)FMath::RoundToInt(Normalized * MAX_int16);
+}
+
+double FLiveLinkAugmentaClusterQuantization::Dequantize(int16 Value, int32 Axis) const
+{
+	return Origin[Axis] + (double)Value / MAX_int16 * HalfRange[Axis];
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// Codec
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	using LiveLinkAugmentaSchema::ObjectFields;
+	using LiveLinkAugmentaSchema::ObjectCompactOrder;
+
+	/**
+	*  Write the fields of a table, unrolled at compile time
+	*  @param  Groups				Object groups to write, the scene and video output fields have no group and are always written
+	*/
+	template<const auto& Fields, const auto& Order, typename StructType>
+	FORCEINLINE void WriteFields(FLiveLinkAugmentaClusterWriter& Writer, const StructType& Value, EAugmentaClusterObjectFields Groups)
+	{
+		LiveLinkAugmentaSchema::ForEachField<Order>([&Writer, &Value, Groups](auto Index)
+		{
+			constexpr const auto& Field = Fields[decltype(Index)::Value];
+
+			if (Field.CompactGroup == EAugmentaClusterObjectFields::None || EnumHasAnyFlags(Groups, Field.CompactGroup))
+			{
+				if constexpr (Field.CompactEncoding == EAugmentaCompactEncoding::VarInt)
+				{
+					Writer.WriteVarInt((int32)Field.Get(Value));
+				}
+				else
+				{
+					Writer.WriteFloat((float)Field.Get(Value));
+				}
+			}
+		});
+	}
+
+	template<const auto& Fields, const auto& Order, typename StructType>
+	FORCEINLINE void ReadFields(FLiveLinkAugmentaClusterReader& Reader, StructType& Value, EAugmentaClusterObjectFields Groups)
+	{
+		LiveLinkAugmentaSchema::ForEachField<Order>([&Reader, &Value, Groups](auto Index)
+		{
+			constexpr const auto& Field = Fields[decltype(Index)::Value];
+
+			if (Field.CompactGroup == EAugmentaClusterObjectFields::None || EnumHasAnyFlags(Groups, Field.CompactGroup))
+			{
+				if constexpr (Field.CompactEncoding == EAugmentaCompactEncoding::VarInt)
+				{
+					Field.Set(Value, Reader.ReadVarInt());
+				}
+				else
+				{
+					Field.Set(Value, Reader.ReadFloat());
+				}
+			}
+		});
+	}
+
+	// Size in bytes of each object group, varints excluded
+	struct FAugmentaCompactGroupSizes
+	{
+		int32 Sizes[16] = {};
+	};
+
+	constexpr FAugmentaCompactGroupSizes MakeObjectGroupSizes()
+	{
+		FAugmentaCompactGroupSizes GroupSizes;
+
+		for (int32 Bit = 0; Bit < 16; Bit++)
+		{
+			GroupSizes.Sizes[Bit] = LiveLinkAugmentaSchema::GetCompactFixedSize(ObjectFields, (EAugmentaClusterObjectFields)(1 << Bit));
+		}
+
+		//Groups encoded by hand: quantized position, yaw, half float scale and date ticks
+		GroupSizes.Sizes[0] = 3 * sizeof(uint16);
+		GroupSizes.Sizes[1] = sizeof(uint16);
+		GroupSizes.Sizes[2] = 3 * sizeof(uint16);
+		GroupSizes.Sizes[14] = sizeof(uint64);
+
+		return GroupSizes;
+	}
+
+	constexpr FAugmentaCompactGroupSizes ObjectGroupSizes = MakeObjectGroupSizes();
+
+	constexpr int32 GetFixedObjectSize()
+	{
+		int32 Size = 0;
+
+		for (int32 Bit = 0; Bit < 16; Bit++)
+		{
+			Size += ObjectGroupSizes.Sizes[Bit];
+		}
+
+		return Size;
+	}
+
+	static_assert((uint32)EAugmentaClusterObjectFields::Position == 1 << 0 && (uint32)EAugmentaClusterObjectFields::Rotation == 1 << 1
+		&& (uint32)EAugmentaClusterObjectFields::Scale == 1 << 2 && (uint32)EAugmentaClusterObjectFields::LastUpdateTime == 1 << 14, "Bits of the groups encoded by hand");
+
+	static_assert(GetFixedObjectSize() == 86, "The compact object layout changed, increment FLiveLinkAugmentaClusterCodec::FormatVersion and update this check");
+}
+
+bool FLiveLinkAugmentaClusterCodec::ReadVersion(FLiveLinkAugmentaClusterReader& Reader)
+{
+	if (Reader.ReadUInt8() != FormatVersion)
+	{
+		Reader.SetError();
+		return false;
+	}
+
+	return !Reader.HasError();
+}
+
+void FLiveLinkAugmentaClusterCodec::WriteQuantization(FLiveLinkAugmentaClusterWriter& Writer, const FLiveLinkAugmentaClusterQuantization& Quantization)
+{
+	for (int32 Axis = 0; Axis < 3; Axis++) { Writer.WriteFloat(Quantization.Origin[Axis]); }
+	for (int32 Axis = 0; Axis < 3; Axis++) { Writer.WriteFloat(Quantization.HalfRange[Axis]); }
+}
+
+void FLiveLinkAugmentaClusterCodec::ReadQuantization(FLiveLinkAugmentaClusterReader& Reader, FLiveLinkAugmentaClusterQuantization& Quantization)
+{
+	for (int32 Axis = 0; Axis < 3; Axis++) { Quantization.Origin[Axis] = Reader.ReadFloat(); }
+	for (int32 Axis = 0; Axis < 3; Axis++) { Quantization.HalfRange[Axis] = Reader.ReadFloat(); }
+
+	//A zero range would divide by zero when quantizing
+	if (Quantization.HalfRange.GetMin() <= 0)
+	{
+		Reader.SetError();
+	}
+}
+
+void FLiveLinkAugmentaClusterCodec::WriteScene(FLiveLinkAugmentaClusterWriter& Writer, const FLiveLinkAugmentaScene& AugmentaScene)
+{
+	WriteFields<LiveLinkAugmentaSchema::SceneFields, LiveLinkAugmentaSchema::SceneCompactOrder>(Writer, AugmentaScene, EAugmentaClusterObjectFields::All);
+}
+
+void FLiveLinkAugmentaClusterCodec::ReadScene(FLiveLinkAugmentaClusterReader& Reader, FLiveLinkAugmentaScene& AugmentaScene)
+{
+	ReadFields<LiveLinkAugmentaSchema::SceneFields, LiveLinkAugmentaSchema::SceneCompactOrder>(Reader, AugmentaScene, EAugmentaClusterObjectFields::All);
+}
+
+void FLiveLinkAugmentaClusterCodec::WriteVideoOutput(FLiveLinkAugmentaClusterWriter& Writer, const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput)
+{
+	WriteFields<LiveLinkAugmentaSchema::VideoOutputFields, LiveLinkAugmentaSchema::VideoOutputCompactOrder>(Writer, AugmentaVideoOutput, EAugmentaClusterObjectFields::All);
+}
+
+void FLiveLinkAugmentaClusterCodec::ReadVideoOutput(FLiveLinkAugmentaClusterReader& Reader, FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput)
+{
+	ReadFields<LiveLinkAugmentaSchema::VideoOutputFields, LiveLinkAugmentaSchema::VideoOutputCompactOrder>(Reader, AugmentaVideoOutput, EAugmentaClusterObjectFields::All);
+}
+
+void FLiveLinkAugmentaClusterCodec::WriteObject(FLiveLinkAugmentaClusterWriter& Writer, const FLiveLinkAugmentaObject& AugmentaObject, EAugmentaClusterObjectFields Fields, const FLiveLinkAugmentaClusterQuantization& Quantization)
+{
+	Writer.WriteVarInt(AugmentaObject.Id);
+	Writer.WriteVarUInt((uint32)Fields);
+
+	if (EnumHasAnyFlags(Fields, EAugmentaClusterObjectFields::Position))
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++) { Writer.WriteUInt16((uint16)Quantization.Quantize(AugmentaObject.Position[Axis], Axis)); }
+	}
+
+	if (EnumHasAnyFlags(Fields, EAugmentaClusterObjectFields::Rotation))
+	{
+		Writer.WriteUInt16(FRotator::CompressAxisToShort(AugmentaObject.Rotation.Rotator().Yaw));
+	}
+
+	if (EnumHasAnyFlags(Fields, EAugmentaClusterObjectFields::Scale))
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++) { Writer.WriteUInt16(FFloat16((float)AugmentaObject.Scale[Axis]).Encoded); }
+	}
+
+	//Fields described by the schema, in group order
+	WriteFields<ObjectFields, ObjectCompactOrder>(Writer, AugmentaObject, Fields);
+
+	if (EnumHasAnyFlags(Fields, EAugmentaClusterObjectFields::LastUpdateTime)) { Writer.WriteUInt64((uint64)AugmentaObject.LastUpdateTime.GetTicks()); }
+}
+
+EAugmentaClusterObjectFields FLiveLinkAugmentaClusterCodec::ReadObject(FLiveLinkAugmentaClusterReader& Reader, FLiveLinkAugmentaObject& AugmentaObject, const FLiveLinkAugmentaClusterQuantization& Quantization)
+{
+	AugmentaObject.Id = ReadObjectId(Reader);
+
+	return ReadObjectFields(Reader, AugmentaObject, Quantization);
+}
+
+EAugmentaClusterObjectFields FLiveLinkAugmentaClusterCodec::ReadObjectFields(FLiveLinkAugmentaClusterReader& Reader, FLiveLinkAugmentaObject& AugmentaObject, const FLiveLinkAugmentaClusterQuantization& Quantization)
+{
+	const uint32 FieldBits = Reader.ReadVarUInt();
+
+	//Fields unknown to this version can not be skipped
+	if (FieldBits & ~(uint32)EAugmentaClusterObjectFields::All)
+	{
+		Reader.SetError();
+		return EAugmentaClusterObjectFields::None;
+	}
+
+	const EAugmentaClusterObjectFields Fields = (EAugmentaClusterObjectFields)FieldBits;
+
+	if (EnumHasAnyFlags(Fields, EAugmentaClusterObjectFields::Position))
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++) { AugmentaObject.Position[Axis] = Quantization.Dequantize((int16)Reader.ReadUInt16(), Axis); }
+	}
+
+	if (EnumHasAnyFlags(Fields, EAugmentaClusterObjectFields::Rotation))
+	{
+		AugmentaObject.Rotation = FQuat(FRotator(0, FRotator::DecompressAxisFromShort(Reader.ReadUInt16()), 0));
+	}
+
+	if (EnumHasAnyFlags(Fields, EAugmentaClusterObjectFields::Scale))
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			FFloat16 Scale;
+			Scale.Encoded = Reader.ReadUInt16();
+			AugmentaObject.Scale[Axis] = Scale.GetFloat();
+		}
+	}
+
+	ReadFields<ObjectFields, ObjectCompactOrder>(Reader, AugmentaObject, Fields);
+
+	if (EnumHasAnyFlags(Fields, EAugmentaClusterObjectFields::LastUpdateTime)) { AugmentaObject.LastUpdateTime = FDateTime((int64)Reader.ReadUInt64()); }
+
+	return Fields;
+}
+
+EAugmentaClusterObjectFields FLiveLinkAugmentaClusterCodec::GetChangedFields(const FLiveLinkAugmentaObject& Previous, const FLiveLinkAugmentaObject& Current, const FLiveLinkAugmentaClusterQuantization& Quantization)
+{
+	EAugmentaClusterObjectFields Fields = EAugmentaClusterObjectFields::None;
+
+	//Compare the quantized values so that changes smaller than the precision of the format are not sent
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		if (Quantization.Quantize(Previous.Position[Axis], Axis) != Quantization.Quantize(Current.Position[Axis], Axis))
+		{
+			Fields |= EAugmentaClusterObjectFields::Position;
+		}
+
+		if (FFloat16((float)Previous.Scale[Axis]).Encoded != FFloat16((float)Current.Scale[Axis]).Encoded)
+		{
+			Fields |= EAugmentaClusterObjectFields::Scale;
+		}
+	}
+
+	if (FRotator::CompressAxisToShort(Previous.Rotation.Rotator().Yaw) != FRotator::CompressAxisToShort(Current.Rotation.Rotator().Yaw))
+	{
+		Fields |= EAugmentaClusterObjectFields::Rotation;
+	}
+
+	LiveLinkAugmentaSchema::ForEachField<ObjectCompactOrder>([&Previous, &Current, &Fields](auto Index)
+	{
+		constexpr const auto& Field = ObjectFields[decltype(Index)::Value];
+
+		if (Field.Get(Previous) != Field.Get(Current))
+		{
+			Fields |= Field.CompactGroup;
+		}
+	});
+
+	if (Previous.LastUpdateTime != Current.LastUpdateTime) { Fields |= EAugmentaClusterObjectFields::LastUpdateTime; }
+
+	return Fields;
+}
+
+int32 FLiveLinkAugmentaClusterCodec::GetVarUIntSize(uint32 Value)
+{
+	int32 Size = 1;
+
+	while (Value >= 0x80)
+	{
+		Value >>= 7;
+		Size++;
+	}
+
+	return Size;
+}
+
+int32 FLiveLinkAugmentaClusterCodec::GetObjectSize(const FLiveLinkAugmentaObject& AugmentaObject, EAugmentaClusterObjectFields Fields)
+{
+	auto GetVarIntSize = [](int32 Value) { return GetVarUIntSize(((uint32)Value << 1) ^ (uint32)(Value >> 31)); };
+
+	int32 Size = GetVarIntSize(AugmentaObject.Id) + GetVarUIntSize((uint32)Fields);
+
+	for (uint32 FieldBits = (uint32)Fields; FieldBits != 0; FieldBits &= FieldBits - 1)
+	{
+		Size += ObjectGroupSizes.Sizes[FMath::CountTrailingZeros(FieldBits)];
+	}
+
+	LiveLinkAugmentaSchema::ForEachField<ObjectCompactOrder>([&AugmentaObject, &Size, &GetVarIntSize, Fields](auto Index)
+	{
+		constexpr const auto& Field = ObjectFields[decltype(Index)::Value];
+
+		if constexpr (Field.CompactEncoding == EAugmentaCompactEncoding::VarInt)
+		{
+			Size += EnumHasAnyFlags(Fields, Field.CompactGroup) ? GetVarIntSize((int32)Field.Get(AugmentaObject)) : 0;
+		}
+	});
+
+	return Size;
+}
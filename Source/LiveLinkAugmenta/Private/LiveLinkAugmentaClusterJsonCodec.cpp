@@ -0,0 +1,286 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaClusterJsonCodec.h"
+#include "LiveLinkAugmentaSchema.h"
+
+namespace
+{
+	using LiveLinkAugmentaSchema::SceneFields;
+	using LiveLinkAugmentaSchema::VideoOutputFields;
+	using LiveLinkAugmentaSchema::ObjectFields;
+
+	// LastUpdateTime is split in one parameter per component, and is only valid once all of them are read
+	const TCHAR* const DateTimeKeys[] =
+	{
+		TEXT("LastUpdateTimeYear"),
+		TEXT("LastUpdateTimeMonth"),
+		TEXT("LastUpdateTimeDay"),
+		TEXT("LastUpdateTimeHour"),
+		TEXT("LastUpdateTimeMinute"),
+		TEXT("LastUpdateTimeSecond"),
+		TEXT("LastUpdateTimeMillisecond")
+	};
+
+	const int32 DateTimeKeyCount = UE_ARRAY_COUNT(DateTimeKeys);
+
+	// Key -> index in the fields table, date time keys following the fields
+	template<typename StructType, int32 FieldCount>
+	TMap<FString, int32> MakeKeyTable(const TAugmentaSchemaField<StructType>(&Fields)[FieldCount], bool bWithDateTime)
+	{
+		TMap<FString, int32> KeyTable;
+		KeyTable.Reserve(FieldCount + DateTimeKeyCount);
+
+		for (int32 i = 0; i < FieldCount; i++)
+		{
+			KeyTable.Add(Fields[i].JsonKey, i);
+		}
+
+		for (int32 i = 0; bWithDateTime && i < DateTimeKeyCount; i++)
+		{
+			KeyTable.Add(DateTimeKeys[i], FieldCount + i);
+		}
+
+		return KeyTable;
+	}
+
+	template<typename StructType, int32 FieldCount>
+	void WriteFields(const StructType& Value, const TAugmentaSchemaField<StructType>(&Fields)[FieldCount], bool bReducedData, TMap<FString, FString>& EventData)
+	{
+		for (int32 i = 0; i < FieldCount; i++)
+		{
+			if (bReducedData && !Fields[i].bIsReduced)
+			{
+				continue;
+			}
+
+			const double FieldValue = Fields[i].Get(Value);
+			EventData.Add(Fields[i].JsonKey, Fields[i].bIsInteger ? FString::FromInt((int32)FieldValue) : FLiveLinkAugmentaClusterJsonCodec::FormatFloat(FieldValue));
+		}
+	}
+
+	/**
+	*  Read the fields of a structure from json parameters
+	*  @param  DateTime				Receives the LastUpdateTime components found, can be null if the structure has none
+	*  @param  FoundFields			Bit i set if field i was found
+	*  @return The number of fields found
+	*/
+	template<typename StructType, int32 FieldCount>
+	int32 ReadFields(const TMap<FString, FString>& EventData, const TMap<FString, int32>& KeyTable, const TAugmentaSchemaField<StructType>(&Fields)[FieldCount], StructType& Value, int32* DateTime, uint64& FoundFields)
+	{
+		static_assert(FieldCount + DateTimeKeyCount <= 64, "Too many fields for the found fields mask");
+
+		int32 FoundFieldCount = 0;
+		FoundFields = 0;
+
+		for (const TPair<FString, FString>& Parameter : EventData)
+		{
+			const int32* FieldIndex = KeyTable.Find(Parameter.Key);
+
+			if (!FieldIndex)
+			{
+				continue;
+			}
+
+			if (*FieldIndex < FieldCount)
+			{
+				const TAugmentaSchemaField<StructType>& Field = Fields[*FieldIndex];
+				Field.Set(Value, Field.bIsInteger ? (double)FCString::Atoi(*Parameter.Value) : FLiveLinkAugmentaClusterJsonCodec::ParseFloat(*Parameter.Value));
+			}
+			else if (DateTime)
+			{
+				DateTime[*FieldIndex - FieldCount] = FCString::Atoi(*Parameter.Value);
+			}
+
+			FoundFields |= 1ull << *FieldIndex;
+			FoundFieldCount++;
+		}
+
+		return FoundFieldCount;
+	}
+
+	const double PowersOfTen[] =
+	{
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+}
+
+void FLiveLinkAugmentaClusterJsonCodec::WriteScene(const FLiveLinkAugmentaScene& AugmentaScene, TMap<FString, FString>& EventData)
+{
+	EventData.Reset();
+	EventData.Reserve(UE_ARRAY_COUNT(SceneFields));
+
+	WriteFields(AugmentaScene, SceneFields, false, EventData);
+}
+
+bool FLiveLinkAugmentaClusterJsonCodec::ReadScene(const TMap<FString, FString>& EventData, FLiveLinkAugmentaScene& AugmentaScene)
+{
+	static const TMap<FString, int32> KeyTable = MakeKeyTable(SceneFields, false);
+
+	uint64 FoundFields;
+	return ReadFields(EventData, KeyTable, SceneFields, AugmentaScene, nullptr, FoundFields) == UE_ARRAY_COUNT(SceneFields);
+}
+
+void FLiveLinkAugmentaClusterJsonCodec::WriteVideoOutput(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput, TMap<FString, FString>& EventData)
+{
+	EventData.Reset();
+	EventData.Reserve(UE_ARRAY_COUNT(VideoOutputFields));
+
+	WriteFields(AugmentaVideoOutput, VideoOutputFields, false, EventData);
+}
+
+bool FLiveLinkAugmentaClusterJsonCodec::ReadVideoOutput(const TMap<FString, FString>& EventData, FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput)
+{
+	static const TMap<FString, int32> KeyTable = MakeKeyTable(VideoOutputFields, false);
+
+	uint64 FoundFields;
+	return ReadFields(EventData, KeyTable, VideoOutputFields, AugmentaVideoOutput, nullptr, FoundFields) == UE_ARRAY_COUNT(VideoOutputFields);
+}
+
+void FLiveLinkAugmentaClusterJsonCodec::WriteObject(const FLiveLinkAugmentaObject& AugmentaObject, bool bReducedData, TMap<FString, FString>& EventData)
+{
+	const int32 ReducedFieldCount = FMath::CountBits(LiveLinkAugmentaSchema::GetReducedFieldsMask(ObjectFields));
+
+	EventData.Reset();
+	EventData.Reserve(bReducedData ? ReducedFieldCount : UE_ARRAY_COUNT(ObjectFields) + DateTimeKeyCount);
+
+	WriteFields(AugmentaObject, ObjectFields, bReducedData, EventData);
+
+	if (!bReducedData)
+	{
+		const FDateTime& LastUpdateTime = AugmentaObject.LastUpdateTime;
+		const int32 DateTime[] = { LastUpdateTime.GetYear(), LastUpdateTime.GetMonth(), LastUpdateTime.GetDay(), LastUpdateTime.GetHour(), LastUpdateTime.GetMinute(), LastUpdateTime.GetSecond(), LastUpdateTime.GetMillisecond() };
+
+		for (int32 i = 0; i < DateTimeKeyCount; i++)
+		{
+			EventData.Add(DateTimeKeys[i], FString::FromInt(DateTime[i]));
+		}
+	}
+}
+
+bool FLiveLinkAugmentaClusterJsonCodec::ReadObject(const TMap<FString, FString>& EventData, FLiveLinkAugmentaObject& AugmentaObject)
+{
+	static const TMap<FString, int32> KeyTable = MakeKeyTable(ObjectFields, true);
+
+	constexpr int32 FieldCount = UE_ARRAY_COUNT(ObjectFields);
+	constexpr uint64 ReducedFieldsMask = LiveLinkAugmentaSchema::GetReducedFieldsMask(ObjectFields);
+	constexpr uint64 DateTimeFieldsMask = ((1ull << DateTimeKeyCount) - 1) << FieldCount;
+
+	int32 DateTime[DateTimeKeyCount] = {};
+	uint64 FoundFields;
+	ReadFields(EventData, KeyTable, ObjectFields, AugmentaObject, DateTime, FoundFields);
+
+	if ((FoundFields & DateTimeFieldsMask) == DateTimeFieldsMask
+		&& FDateTime::Validate(DateTime[0], DateTime[1], DateTime[2], DateTime[3], DateTime[4], DateTime[5], DateTime[6]))
+	{
+		AugmentaObject.LastUpdateTime = FDateTime(DateTime[0], DateTime[1], DateTime[2], DateTime[3], DateTime[4], DateTime[5], DateTime[6]);
+	}
+
+	return (FoundFields & ReducedFieldsMask) == ReducedFieldsMask;
+}
+
+FString FLiveLinkAugmentaClusterJsonCodec::FormatFloat(double Value)
+{
+	//Keep the scaled value in 64 bits, larger values are printed the usual way
+	if (!FMath::IsFinite(Value) || FMath::Abs(Value) >= 1e12)
+	{
+		return FString::SanitizeFloat(Value);
+	}
+
+	TCHAR Buffer[32];
+	TCHAR* const End = Buffer + UE_ARRAY_COUNT(Buffer);
+	TCHAR* Cursor = End;
+
+	const uint64 Scaled = (uint64)(FMath::Abs(Value) * 1e6 + 0.5);
+	uint64 Integer = Scaled / 1000000;
+	uint32 Fraction = (uint32)(Scaled % 1000000);
+
+	//Trailing zeros are removed, keeping at least one decimal like SanitizeFloat
+	int32 FractionDigits = 6;
+	while (FractionDigits > 1 && Fraction % 10 == 0)
+	{
+		Fraction /= 10;
+		FractionDigits--;
+	}
+
+	for (int32 i = 0; i < FractionDigits; i++)
+	{
+		*--Cursor = TEXT('0') + (TCHAR)(Fraction % 10);
+		Fraction /= 10;
+	}
+
+	*--Cursor = TEXT('.');
+
+	do
+	{
+		*--Cursor = TEXT('0') + (TCHAR)(Integer % 10);
+		Integer /= 10;
+	} while (Integer > 0);
+
+	if (Value < 0 && Scaled > 0)
+	{
+		*--Cursor = TEXT('-');
+	}
+
+	return FString((int32)(End - Cursor), Cursor);
+}
+
+double FLiveLinkAugmentaClusterJsonCodec::ParseFloat(const TCHAR* Value)
+{
+	const TCHAR* Cursor = Value;
+
+	while (FChar::IsWhitespace(*Cursor)) { Cursor++; }
+
+	const bool bNegative = *Cursor == TEXT('-');
+	if (bNegative || *Cursor == TEXT('+')) { Cursor++; }
+
+	uint64 Mantissa = 0;
+	int32 Exponent = 0;
+	int32 SignificantDigits = 0;
+	bool bHasDigits = false;
+	bool bIsFraction = false;
+
+	for (;; Cursor++)
+	{
+		if (FChar::IsDigit(*Cursor))
+		{
+			const int32 Digit = *Cursor - TEXT('0');
+			bHasDigits = true;
+
+			//Leading zeros are not significant
+			if (Mantissa == 0 && Digit == 0)
+			{
+				Exponent -= bIsFraction ? 1 : 0;
+				continue;
+			}
+
+			if (SignificantDigits >= 19)
+			{
+				return FCString::Atod(Value);
+			}
+
+			Mantissa = Mantissa * 10 + Digit;
+			SignificantDigits++;
+			Exponent -= bIsFraction ? 1 : 0;
+		}
+		else if (*Cursor == TEXT('.') && !bIsFraction)
+		{
+			bIsFraction = true;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	//Exponents, inf, nan or values that can not be converted exactly take the slow path
+	const uint64 MaxExactMantissa = 1ull << 53;
+	if (!bHasDigits || *Cursor != 0 || Mantissa > MaxExactMantissa || Exponent < -22 || Exponent > 22)
+	{
+		return FCString::Atod(Value);
+	}
+
+	const double Result = Exponent < 0 ? (double)Mantissa / PowersOfTen[-Exponent] : (double)Mantissa * PowersOfTen[Exponent];
+
+	return bNegative ? -Result : Result;
+}
@@ -3,14 +3,163 @@
 
 #include "LiveLinkAugmentaClusterManager.h"
 
+#include "LiveLinkAugmentaClusterJsonCodec.h"
+#include "LiveLinkAugmentaManager.h"
+#include "LiveLinkAugmentaSource.h"
+
 #include "Cluster/IDisplayClusterClusterManager.h"
+#include "DisplayClusterRootActor.h"
+#include "Game/IDisplayClusterGameManager.h"
 #include "IDisplayCluster.h"
+#include "Render/Viewport/IDisplayClusterViewport.h"
+#include "Render/Viewport/IDisplayClusterViewportManager.h"
+#include "ILiveLinkClient.h"
+#include "Features/IModularFeatures.h"
+#include "Misc/Base64.h"
+
+namespace
+{
+	// Flags of a batched frame cluster event
+	enum class EAugmentaFrameBatchFlags : uint8
+	{
+		None = 0,
+		HasScene = 1 << 0,
+		HasVideoOutput = 1 << 1,
+		// Updated and left objects only carry the fields changed since the last frame
+		Delta = 1 << 2,
+		// The state of every other object follows the left objects
+		Keyframe = 1 << 3,
+		// The objects are split in one chunk per node, see WriteInterestChunks
+		InterestChunks = 1 << 4
+	};
+	ENUM_CLASS_FLAGS(EAugmentaFrameBatchFlags);
+
+	// Header of a batched frame cluster event, followed by the scene, the video output and the entered, updated and left objects
+	struct FAugmentaFrameBatchHeader
+	{
+		EAugmentaFrameBatchFlags Flags;
+		int32 EnteredObjectCount;
+		int32 UpdatedObjectCount;
+		int32 LeftObjectCount;
+	};
+
+	template<typename T>
+	void WriteBinary(uint8*& Cursor, const T& Value)
+	{
+		FMemory::Memcpy(Cursor, &Value, sizeof(T));
+		Cursor += sizeof(T);
+	}
+
+	void WriteBinaryObjects(uint8*& Cursor, const TArray<FLiveLinkAugmentaObject>& AugmentaObjects)
+	{
+		const int32 Size = AugmentaObjects.Num() * sizeof(FLiveLinkAugmentaObject);
+		FMemory::Memcpy(Cursor, AugmentaObjects.GetData(), Size);
+		Cursor += Size;
+	}
+
+	template<typename T>
+	bool ReadBinary(const uint8*& Cursor, const uint8* End, T& Value)
+	{
+		if (End - Cursor < (int64)sizeof(T))
+		{
+			return false;
+		}
+
+		FMemory::Memcpy(&Value, Cursor, sizeof(T));
+		Cursor += sizeof(T);
+		return true;
+	}
+
+	bool ReadBinaryObjects(const uint8*& Cursor, const uint8* End, int32 Count, TArray<FLiveLinkAugmentaObject>& AugmentaObjects)
+	{
+		const int64 Size = (int64)Count * sizeof(FLiveLinkAugmentaObject);
+
+		if (Count < 0 || End - Cursor < Size)
+		{
+			return false;
+		}
+
+		AugmentaObjects.SetNumUninitialized(Count, EAllowShrinking::No);
+		FMemory::Memcpy(AugmentaObjects.GetData(), Cursor, Size);
+		Cursor += Size;
+		return true;
+	}
+
+	void WriteNodeId(FLiveLinkAugmentaClusterWriter& Writer, const FString& NodeId)
+	{
+		const FTCHARToUTF8 Utf8NodeId(*NodeId);
+
+		Writer.WriteVarUInt(Utf8NodeId.Length());
+		Writer.WriteBytes((const uint8*)Utf8NodeId.Get(), Utf8NodeId.Length());
+	}
+
+	FString ReadNodeId(FLiveLinkAugmentaClusterReader& Reader)
+	{
+		const int32 Length = (int32)Reader.ReadVarUInt();
+		const uint8* Bytes = Reader.ReadBytes(Length);
+
+		if (!Bytes)
+		{
+			return FString();
+		}
+
+		const FUTF8ToTCHAR NodeId((const ANSICHAR*)Bytes, Length);
+		return FString(NodeId.Length(), NodeId.Get());
+	}
+
+	/**
+	*  Add the footprint of a view on the plane Z = 0 of the Augmenta scene to a region
+	*  @return FALSE if a corner of the view does not hit the plane
+	*/
+	bool AddViewFootprint(const FVector& ViewLocation, const FRotator& ViewRotation, const FMatrix& ProjectionMatrix, const FTransform& SceneTransform, FBox2D& Region)
+	{
+		//Same view matrix as the renderer, Unreal axes to view axes
+		const FMatrix ViewRotationMatrix = FInverseRotationMatrix(ViewRotation) * FMatrix(
+			FPlane(0, 0, 1, 0),
+			FPlane(1, 0, 0, 0),
+			FPlane(0, 1, 0, 0),
+			FPlane(0, 0, 0, 1));
+
+		const FMatrix InverseViewProjection = (FTranslationMatrix(-ViewLocation) * ViewRotationMatrix * ProjectionMatrix).Inverse();
+
+		auto Unproject = [&InverseViewProjection, &SceneTransform](double X, double Y, double Z)
+		{
+			const FVector4 Point = InverseViewProjection.TransformFVector4(FVector4(X, Y, Z, 1));
+			return SceneTransform.InverseTransformPosition(FVector(Point) / Point.W);
+		};
+
+		static const FVector2D Corners[] = { FVector2D(-1, -1), FVector2D(1, -1), FVector2D(1, 1), FVector2D(-1, 1) };
+
+		for (const FVector2D& Corner : Corners)
+		{
+			//Depth is reversed, 1 is the near plane
+			const FVector Near = Unproject(Corner.X, Corner.Y, 1);
+			const FVector Direction = Unproject(Corner.X, Corner.Y, 0.5) - Near;
+
+			if (FMath::IsNearlyZero(Direction.Z))
+			{
+				return false;
+			}
+
+			const double Distance = -Near.Z / Direction.Z;
+			if (Distance < 0)
+			{
+				return false;
+			}
+
+			Region += FVector2D(Near + Direction * Distance);
+		}
+
+		return true;
+	}
+}
 
 // Sets default values
 ALiveLinkAugmentaClusterManager::ALiveLinkAugmentaClusterManager()
 {
  	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = false;
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	AugmentaEventDispatcher = nullptr;
 	ClusterManager = nullptr;
@@ -18,6 +167,19 @@ ALiveLinkAugmentaClusterManager::ALiveLinkAugmentaClusterManager()
 	bInitialized = false;
 	bUseBinaryClusterEvents = true;
 	BinaryEventIdOffset = 0;
+	bBatchReceivedEvents = true;
+	ReplicationMode = EAugmentaClusterReplicationMode::PerEvent;
+	WireFormat = EAugmentaClusterWireFormat::Raw;
+	bUseDeltaCompression = false;
+	KeyframeInterval = 120;
+	FrameSelectionDelay = 1;
+	bCreateClusterLiveLinkSource = false;
+	ClusterLiveLinkSceneName = "AugmentaCluster";
+	bUseInterestManagement = false;
+	InterestMargin = 200;
+	InterestSceneOrigin = nullptr;
+	bUseInterestRegionOverride = false;
+	InterestRegionOverride = FBox2D(ForceInit);
 }
 
 // Called when the game starts or when spawned
@@ -38,15 +200,97 @@ void ALiveLinkAugmentaClusterManager::BeginPlay()
 	//Bind to Augmenta Manager events
 	if(ensure(AugmentaEventDispatcher))
 	{
-		AugmentaEventDispatcher->OnAugmentaSceneUpdated.AddDynamic(this, &ALiveLinkAugmentaClusterManager::SendSceneUpdatedClusterEvent);
-		AugmentaEventDispatcher->OnAugmentaVideoOutputUpdated.AddDynamic(this, &ALiveLinkAugmentaClusterManager::SendVideoOutputUpdatedClusterEvent);
-		AugmentaEventDispatcher->OnAugmentaObjectEntered.AddDynamic(this, &ALiveLinkAugmentaClusterManager::SendObjectEnteredClusterEvent);
-		AugmentaEventDispatcher->OnAugmentaObjectUpdated.AddDynamic(this, &ALiveLinkAugmentaClusterManager::SendObjectUpdatedClusterEvent);
-		AugmentaEventDispatcher->OnAugmentaObjectLeft.AddDynamic(this, &ALiveLinkAugmentaClusterManager::SendObjectLeftClusterEvent);
-		AugmentaEventDispatcher->OnAugmentaSourceDestroyed.AddDynamic(this, &ALiveLinkAugmentaClusterManager::SendSourceDestroyedClusterEvent);
+		if (ReplicationMode == EAugmentaClusterReplicationMode::BatchedFrame && !bUseBinaryClusterEvents)
+		{
+			UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Batched frame replication requires binary cluster events, falling back to per event replication."));
+			ReplicationMode = EAugmentaClusterReplicationMode::PerEvent;
+		}
+
+		if (bUseDeltaCompression && !IsDeltaCompressionActive())
+		{
+			UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Delta compression requires batched frame replication, the compact wire format and no interest management, it is disabled."));
+		}
+
+		if (bUseInterestManagement && !IsInterestManagementActive())
+		{
+			UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Interest management requires batched frame replication and the compact wire format, it is disabled."));
+		}
+
+		if (ClusterManager)
+		{
+			LocalNodeId = ClusterManager->GetNodeId();
+		}
+
+		if (ReplicationMode == EAugmentaClusterReplicationMode::LocalIngest)
+		{
+			IngestManager = Cast<ALiveLinkAugmentaManager>(AugmentaEventDispatcher);
+
+			if (!IngestManager || !bUseBinaryClusterEvents || !ClusterManager)
+			{
+				UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Local ingest replication requires an Augmenta Manager as Augmenta Event Dispatcher and binary cluster events, falling back to per event replication."));
+				ReplicationMode = EAugmentaClusterReplicationMode::PerEvent;
+				IngestManager = nullptr;
+			}
+		}
+
+		if (ReplicationMode == EAugmentaClusterReplicationMode::SyncObject && !ClusterManager)
+		{
+			UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Sync object replication requires the Display Cluster Manager, falling back to per event replication."));
+			ReplicationMode = EAugmentaClusterReplicationMode::PerEvent;
+		}
+
+		if (ReplicationMode == EAugmentaClusterReplicationMode::LocalIngest)
+		{
+			//Objects are read from the local source, only the frame selection goes through the cluster
+			bIsPrimary = ClusterManager->IsPrimary();
+			SetActorTickEnabled(true);
+		}
+		else if (ReplicationMode == EAugmentaClusterReplicationMode::SyncObject)
+		{
+			AugmentaEventDispatcher->OnAugmentaSceneUpdatedNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::OnAugmentaSceneUpdated);
+			AugmentaEventDispatcher->OnAugmentaVideoOutputUpdatedNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::OnAugmentaVideoOutputUpdated);
+			AugmentaEventDispatcher->OnAugmentaFrameNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::OnAugmentaFrame);
+
+			//nDisplay synchronizes the objects of the Tick group at the start of each frame
+			bIsPrimary = ClusterManager->IsPrimary();
+			SyncObject = MakeUnique<FLiveLinkAugmentaClusterSyncObject>(TEXT("LiveLinkAugmenta_") + GetName());
+			ClusterManager->RegisterSyncObject(SyncObject.Get(), EDisplayClusterSyncGroup::Tick);
+
+			AddTickPrerequisiteActor(AugmentaEventDispatcher);
+			SetActorTickEnabled(true);
+		}
+		else if (ReplicationMode == EAugmentaClusterReplicationMode::BatchedFrame)
+		{
+			AugmentaEventDispatcher->OnAugmentaSceneUpdatedNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::OnAugmentaSceneUpdated);
+			AugmentaEventDispatcher->OnAugmentaVideoOutputUpdatedNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::OnAugmentaVideoOutputUpdated);
+			AugmentaEventDispatcher->OnAugmentaFrameNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::OnAugmentaFrame);
+
+			//Send the frame once the dispatcher propagated all its events
+			AddTickPrerequisiteActor(AugmentaEventDispatcher);
+			SetActorTickEnabled(true);
+		}
+		else
+		{
+			AugmentaEventDispatcher->OnAugmentaSceneUpdatedNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::SendSceneUpdatedClusterEvent);
+			AugmentaEventDispatcher->OnAugmentaVideoOutputUpdatedNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::SendVideoOutputUpdatedClusterEvent);
+			AugmentaEventDispatcher->OnAugmentaObjectEnteredNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::SendObjectEnteredClusterEvent);
+			AugmentaEventDispatcher->OnAugmentaObjectUpdatedNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::SendObjectUpdatedClusterEvent);
+			AugmentaEventDispatcher->OnAugmentaObjectLeftNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::SendObjectLeftClusterEvent);
+
+			//Received events are dispatched in Tick
+			bIsBatchingReceivedEvents = bBatchReceivedEvents;
+			SetActorTickEnabled(bIsBatchingReceivedEvents);
+		}
+
+		AugmentaEventDispatcher->OnAugmentaSourceDestroyedNative.AddUObject(this, &ALiveLinkAugmentaClusterManager::SendSourceDestroyedClusterEvent);
 
 		bInitialized = true;
 
+		if (bCreateClusterLiveLinkSource)
+		{
+			CreateClusterLiveLinkSource();
+		}
+
 		UE_LOG(LogLiveLinkAugmenta, Log, TEXT("Augmenta Cluster Manager bound to Augmenta Manager successfully."));
 	} else
 	{
@@ -62,23 +306,639 @@ void ALiveLinkAugmentaClusterManager::EndPlay(const EEndPlayReason::Type EndPlay
 	//Unbind from cluster event listener
 	if (ClusterManager) {
 		ClusterManager->RemoveClusterEventListener(this);
+
+		if (SyncObject)
+		{
+			ClusterManager->UnregisterSyncObject(SyncObject.Get());
+		}
 	}
 
+	SyncObject.Reset();
+	bHasPublishedSnapshot = false;
+
+	RemoveClusterLiveLinkSource();
+
+	IngestManager = nullptr;
+	bHasSelectedIngestFrame = false;
+	bHasPendingIngestFrame = false;
+
+	InterestRegions.Reset();
+	bHasSentInterestRegion = false;
+
+	bIsBatchingReceivedEvents = false;
+	ReceivedEvents.Reset();
+	bHasReceivedScene = false;
+	bHasReceivedVideoOutput = false;
+
 	//Unbind from Augmenta Manager
 	if (AugmentaEventDispatcher && bInitialized)
 	{
-		AugmentaEventDispatcher->OnAugmentaSceneUpdated.RemoveDynamic(this, &ALiveLinkAugmentaClusterManager::SendSceneUpdatedClusterEvent);
-		AugmentaEventDispatcher->OnAugmentaVideoOutputUpdated.RemoveDynamic(this, &ALiveLinkAugmentaClusterManager::SendVideoOutputUpdatedClusterEvent);
-		AugmentaEventDispatcher->OnAugmentaObjectEntered.RemoveDynamic(this, &ALiveLinkAugmentaClusterManager::SendObjectEnteredClusterEvent);
-		AugmentaEventDispatcher->OnAugmentaObjectUpdated.RemoveDynamic(this, &ALiveLinkAugmentaClusterManager::SendObjectUpdatedClusterEvent);
-		AugmentaEventDispatcher->OnAugmentaObjectLeft.RemoveDynamic(this, &ALiveLinkAugmentaClusterManager::SendObjectLeftClusterEvent);
-		AugmentaEventDispatcher->OnAugmentaSourceDestroyed.RemoveDynamic(this, &ALiveLinkAugmentaClusterManager::SendSourceDestroyedClusterEvent);
+		AugmentaEventDispatcher->OnAugmentaSceneUpdatedNative.RemoveAll(this);
+		AugmentaEventDispatcher->OnAugmentaVideoOutputUpdatedNative.RemoveAll(this);
+		AugmentaEventDispatcher->OnAugmentaObjectEnteredNative.RemoveAll(this);
+		AugmentaEventDispatcher->OnAugmentaObjectUpdatedNative.RemoveAll(this);
+		AugmentaEventDispatcher->OnAugmentaObjectLeftNative.RemoveAll(this);
+		AugmentaEventDispatcher->OnAugmentaFrameNative.RemoveAll(this);
+		AugmentaEventDispatcher->OnAugmentaSourceDestroyedNative.RemoveAll(this);
+	}
+
+	ResetPendingFrame();
+}
+
+void ALiveLinkAugmentaClusterManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bIsBatchingReceivedEvents)
+	{
+		FlushReceivedEvents();
+	}
+
+	if (SyncObject)
+	{
+		TickSyncObject();
+		return;
+	}
+
+	if (IngestManager)
+	{
+		TickLocalIngest();
+		return;
+	}
+
+	if (IsInterestManagementActive())
+	{
+		UpdateInterestRegion();
+	}
+
+	//Keyframes are sent even without events so that nodes recover from a missed event
+	const bool bKeyframe = IsDeltaCompressionActive() && ++FramesSinceKeyframe >= KeyframeInterval;
+
+	if (bKeyframe || bHasPendingScene || bHasPendingVideoOutput || PendingEvents.Num() > 0)
+	{
+		SendFrameClusterEvent(bKeyframe);
+	}
+}
+
+void ALiveLinkAugmentaClusterManager::TickSyncObject()
+{
+	if (!bIsPrimary)
+	{
+		FString Snapshot;
+
+		if (SyncObject->ConsumeSnapshot(Snapshot))
+		{
+			ApplyAugmentaSnapshot(Snapshot);
+		}
+
+		return;
+	}
+
+	//The secondaries received the snapshot published last frame at the start of this one, apply it at the same frame
+	if (bHasPublishedSnapshot)
+	{
+		ApplyAugmentaSnapshot(PublishedSnapshot);
+		bHasPublishedSnapshot = false;
+	}
+
+	if (bSnapshotChanged)
+	{
+		SerializeAugmentaSnapshot(SnapshotData);
+		PublishedSnapshot = FBase64::Encode(SnapshotData);
+		SyncObject->SetSnapshot(PublishedSnapshot);
+
+		LastFrameBytes = PublishedSnapshot.Len();
+		bHasPublishedSnapshot = true;
+		bSnapshotChanged = false;
+	}
+}
+
+void ALiveLinkAugmentaClusterManager::TickLocalIngest()
+{
+	FLiveLinkAugmentaSource* Source = IngestManager->GetLiveLinkAugmentaSource();
+
+	if (!Source)
+	{
+		return;
+	}
+
+	if (!Source->IsBufferingFrames() && !bHasWarnedFrameBuffering)
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Local ingest replication requires bBufferFrames in the settings of the Augmenta source."));
+		bHasWarnedFrameBuffering = true;
+	}
+
+	//The frame selected by the primary node was not received by this node yet
+	if (bHasPendingIngestFrame)
+	{
+		ApplyIngestFrame();
 	}
 
+	if (!bIsPrimary)
+	{
+		return;
+	}
+
+	int32 Frame;
+	if (!Source->GetFrameBuffer().GetLatestFrameNumber(Frame, FrameSelectionDelay) || (bHasSelectedIngestFrame && Frame == SelectedIngestFrame))
+	{
+		return;
+	}
+
+	SelectedIngestFrame = Frame;
+	bHasSelectedIngestFrame = true;
+
+	FDisplayClusterClusterEventBinary Event;
+
+	Event.EventId = 7 + BinaryEventIdOffset;
+	FLiveLinkAugmentaClusterWriter Writer(Event.EventData);
+	Writer.WriteUInt32((uint32)Frame);
+	Event.bIsSystemEvent = false;
+	Event.bShouldDiscardOnRepeat = false;
+
+	ClusterManager->EmitClusterEventBinary(Event, true);
+}
+
+void ALiveLinkAugmentaClusterManager::ApplyIngestFrame()
+{
+	FLiveLinkAugmentaSource* Source = IngestManager ? IngestManager->GetLiveLinkAugmentaSource() : nullptr;
+
+	//Wait for the source to be connected
+	if (!Source)
+	{
+		return;
+	}
+
+	switch (Source->GetFrameBuffer().ReadFrame(PendingIngestFrame, IngestFrame))
+	{
+	case ELiveLinkAugmentaFrameLookup::Pending:
+		return;
+
+	case ELiveLinkAugmentaFrameLookup::Missed:
+		bHasPendingIngestFrame = false;
+		MissedFrameCount++;
+		UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("Augmenta Cluster Manager: Augmenta frame %d selected by the primary node is not buffered on this node."), PendingIngestFrame);
+		return;
+
+	default:
+		break;
+	}
+
+	bHasPendingIngestFrame = false;
+
+	const bool bVideoOutputUpdated = IngestFrame.VideoOutputRevision > 0 && IngestFrame.VideoOutputRevision != AppliedIngestVideoOutputRevision;
+	AppliedIngestVideoOutputRevision = IngestFrame.VideoOutputRevision;
+
+	DiffReceivedObjects(IngestFrame.AugmentaObjects, FLiveLinkAugmentaClusterQuantization::FromScene(IngestFrame.AugmentaScene));
+
+	BroadcastReceivedFrame(&IngestFrame.AugmentaScene, bVideoOutputUpdated ? &IngestFrame.AugmentaVideoOutput : nullptr);
 }
 
-void ALiveLinkAugmentaClusterManager::SendSceneUpdatedClusterEvent(const FLiveLinkAugmentaScene AugmentaScene)
+void ALiveLinkAugmentaClusterManager::CreateClusterLiveLinkSource()
 {
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+
+	if (!ModularFeatures.IsModularFeatureAvailable(ILiveLinkClient::ModularFeatureName))
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Live Link client is not available, the cluster Live Link source is not created."));
+		return;
+	}
+
+	ILiveLinkClient& LiveLinkClient = ModularFeatures.GetModularFeature<ILiveLinkClient>(ILiveLinkClient::ModularFeatureName);
+
+	//Subjects are pushed from the events this cluster manager broadcasts, whatever the replication mode
+	ClusterLiveLinkSource = MakeShared<FLiveLinkAugmentaClusterSource>(ClusterLiveLinkSceneName);
+	ClusterLiveLinkSource->Attach(this);
+	ClusterLiveLinkSourceGuid = LiveLinkClient.AddSource(ClusterLiveLinkSource);
+
+	UE_LOG(LogLiveLinkAugmenta, Log, TEXT("Augmenta Cluster Manager: Created cluster Live Link source for scene %s."), *ClusterLiveLinkSceneName.ToString());
+}
+
+void ALiveLinkAugmentaClusterManager::RemoveClusterLiveLinkSource()
+{
+	if (!ClusterLiveLinkSource)
+	{
+		return;
+	}
+
+	ClusterLiveLinkSource->Detach(this);
+
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+
+	if (ModularFeatures.IsModularFeatureAvailable(ILiveLinkClient::ModularFeatureName))
+	{
+		ModularFeatures.GetModularFeature<ILiveLinkClient>(ILiveLinkClient::ModularFeatureName).RemoveSource(ClusterLiveLinkSourceGuid);
+	}
+
+	ClusterLiveLinkSource.Reset();
+	ClusterLiveLinkSourceGuid.Invalidate();
+}
+
+bool ALiveLinkAugmentaClusterManager::IsDeltaCompressionActive() const
+{
+	return bUseDeltaCompression && !bUseInterestManagement && ReplicationMode == EAugmentaClusterReplicationMode::BatchedFrame && WireFormat == EAugmentaClusterWireFormat::Compact;
+}
+
+bool ALiveLinkAugmentaClusterManager::IsInterestManagementActive() const
+{
+	return bUseInterestManagement && ReplicationMode == EAugmentaClusterReplicationMode::BatchedFrame && WireFormat == EAugmentaClusterWireFormat::Compact;
+}
+
+void ALiveLinkAugmentaClusterManager::UpdateInterestRegion()
+{
+	//Viewports rarely move, no need to project them every frame
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (bHasSentInterestRegion && CurrentTime - LastInterestRegionUpdateTime < 1.0)
+	{
+		return;
+	}
+
+	LastInterestRegionUpdateTime = CurrentTime;
+
+	FBox2D Region(ForceInit);
+	const bool bIsValid = ComputeInterestRegion(Region);
+
+	//Only send significant changes
+	const double Tolerance = InterestMargin * 0.25;
+	if (bHasSentInterestRegion && bIsValid == bSentInterestRegionValid
+		&& (!bIsValid || (Region.Min.Equals(SentInterestRegion.Min, Tolerance) && Region.Max.Equals(SentInterestRegion.Max, Tolerance))))
+	{
+		return;
+	}
+
+	bHasSentInterestRegion = true;
+	bSentInterestRegionValid = bIsValid;
+	SentInterestRegion = Region;
+
+	FDisplayClusterClusterEventBinary Event;
+
+	Event.EventId = 8 + BinaryEventIdOffset;
+	FLiveLinkAugmentaClusterWriter Writer(Event.EventData);
+	WriteNodeId(Writer, LocalNodeId);
+	Writer.WriteUInt8(bIsValid ? 1 : 0);
+	Writer.WriteFloat(Region.Min.X);
+	Writer.WriteFloat(Region.Min.Y);
+	Writer.WriteFloat(Region.Max.X);
+	Writer.WriteFloat(Region.Max.Y);
+	Event.bIsSystemEvent = false;
+	Event.bShouldDiscardOnRepeat = false;
+
+	//Sent by every node to the primary node
+	ClusterManager->EmitClusterEventBinary(Event, false);
+}
+
+bool ALiveLinkAugmentaClusterManager::ComputeInterestRegion(FBox2D& OutRegion) const
+{
+	if (bUseInterestRegionOverride)
+	{
+		OutRegion = InterestRegionOverride;
+		return OutRegion.bIsValid;
+	}
+
+	ADisplayClusterRootActor* RootActor = IDisplayCluster::Get().GetGameMgr()->GetRootActor();
+	IDisplayClusterViewportManager* ViewportManager = RootActor ? RootActor->GetViewportManager() : nullptr;
+
+	if (!ViewportManager)
+	{
+		return false;
+	}
+
+	const FTransform SceneTransform = InterestSceneOrigin ? InterestSceneOrigin->GetActorTransform() : FTransform::Identity;
+
+	//The viewport manager only holds the viewports rendered by this node
+	for (const TSharedPtr<IDisplayClusterViewport, ESPMode::ThreadSafe>& Viewport : ViewportManager->GetViewports())
+	{
+		if (!Viewport.IsValid())
+		{
+			continue;
+		}
+
+		for (const FDisplayClusterViewport_Context& Context : Viewport->GetContexts())
+		{
+			if (!AddViewFootprint(Context.ViewLocation, Context.ViewRotation, Context.ProjectionMatrix, SceneTransform, OutRegion))
+			{
+				return false;
+			}
+		}
+	}
+
+	return OutRegion.bIsValid;
+}
+
+void ALiveLinkAugmentaClusterManager::OnInterestRegionReceived(const TArray<uint8>& EventData)
+{
+	//Only the primary node splits the objects
+	if (!ClusterManager || !ClusterManager->IsPrimary())
+	{
+		return;
+	}
+
+	FLiveLinkAugmentaClusterReader Reader(EventData);
+	const FString NodeId = ReadNodeId(Reader);
+	const bool bIsValid = Reader.ReadUInt8() != 0;
+	FBox2D Region;
+	Region.Min.X = Reader.ReadFloat();
+	Region.Min.Y = Reader.ReadFloat();
+	Region.Max.X = Reader.ReadFloat();
+	Region.Max.Y = Reader.ReadFloat();
+	Region.bIsValid = true;
+
+	if (Reader.HasError() || !Reader.IsAtEnd())
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Received a malformed interest region cluster event of %d bytes."), EventData.Num());
+		return;
+	}
+
+	//The node keeps its own chunk once it has a region, so that the objects it knows stay consistent, and is synchronized with its new region next frame
+	FInterestRegion& InterestRegion = InterestRegions.FindOrAdd(NodeId);
+	InterestRegion.bNeedsSync = true;
+
+	//A node seeing above the horizon receives every object
+	if (!bIsValid)
+	{
+		InterestRegion.Region = FBox2D(FVector2D(-UE_BIG_NUMBER), FVector2D(UE_BIG_NUMBER));
+		UE_LOG(LogLiveLinkAugmenta, Log, TEXT("Augmenta Cluster Manager: Node %s receives every Augmenta object."), *NodeId);
+		return;
+	}
+
+	InterestRegion.Region = Region.ExpandBy(InterestMargin);
+
+	UE_LOG(LogLiveLinkAugmenta, Log, TEXT("Augmenta Cluster Manager: Node %s receives the Augmenta objects in %s."), *NodeId, *Region.ToString());
+}
+
+void ALiveLinkAugmentaClusterManager::WriteInterestChunks(FLiveLinkAugmentaClusterWriter& Writer, EAugmentaClusterObjectFields Fields)
+{
+	//Nodes whose region is unknown read the chunk with an empty node id, holding every object
+	ClusterNodeIds.Reset();
+	ClusterManager->GetNodeIds(ClusterNodeIds);
+
+	const bool bHasDefaultChunk = ClusterNodeIds.ContainsByPredicate([this](const FString& NodeId) { return !InterestRegions.Contains(NodeId); });
+
+	Writer.WriteVarUInt(InterestRegions.Num() + (bHasDefaultChunk ? 1 : 0));
+
+	const TMap<int, FLiveLinkAugmentaObject>& TrackedObjects = AugmentaEventDispatcher->GetTrackedAugmentaObjects();
+
+	//Objects with events this frame, the other tracked objects were already sent to the nodes of the default chunk
+	InterestFrameObjectIds.Reset();
+
+	for (const FLiveLinkAugmentaObject& AugmentaObject : PendingEnteredObjects) { InterestFrameObjectIds.Add(AugmentaObject.Id); }
+	for (const FLiveLinkAugmentaObject& AugmentaObject : PendingUpdatedObjects) { InterestFrameObjectIds.Add(AugmentaObject.Id); }
+	for (const FLiveLinkAugmentaObject& AugmentaObject : PendingLeftObjects) { InterestFrameObjectIds.Add(AugmentaObject.Id); }
+
+	for (TPair<FString, FInterestRegion>& InterestRegion : InterestRegions)
+	{
+		FInterestRegion& Region = InterestRegion.Value;
+
+		InterestEnteredObjects.Reset();
+		InterestUpdatedObjects.Reset();
+		InterestLeftObjects.Reset();
+
+		//A node leaving the default chunk knows every object sent before this frame
+		if (Region.bIsNew)
+		{
+			Region.bIsNew = false;
+			Region.ObjectIds.Reset();
+
+			for (const TPair<int, FLiveLinkAugmentaObject>& TrackedObject : TrackedObjects)
+			{
+				if (!InterestFrameObjectIds.Contains(TrackedObject.Key))
+				{
+					Region.ObjectIds.Add(TrackedObject.Key);
+				}
+			}
+
+			for (const FLiveLinkAugmentaObject& AugmentaObject : PendingUpdatedObjects) { Region.ObjectIds.Add(AugmentaObject.Id); }
+			for (const FLiveLinkAugmentaObject& AugmentaObject : PendingLeftObjects) { Region.ObjectIds.Add(AugmentaObject.Id); }
+			for (const FLiveLinkAugmentaObject& AugmentaObject : PendingEnteredObjects) { Region.ObjectIds.Remove(AugmentaObject.Id); }
+		}
+
+		//Objects enter and leave each node when they cross its region
+		auto AddObject = [&Region, this](const FLiveLinkAugmentaObject& AugmentaObject)
+		{
+			if (Region.Region.IsInside(FVector2D(AugmentaObject.Position)))
+			{
+				bool bIsAlreadyInRegion;
+				Region.ObjectIds.Add(AugmentaObject.Id, &bIsAlreadyInRegion);
+				(bIsAlreadyInRegion ? InterestUpdatedObjects : InterestEnteredObjects).Add(AugmentaObject);
+			}
+			else if (Region.ObjectIds.Remove(AugmentaObject.Id) > 0)
+			{
+				InterestLeftObjects.Add(AugmentaObject);
+			}
+		};
+
+		for (const FLiveLinkAugmentaObject& AugmentaObject : PendingEnteredObjects) { AddObject(AugmentaObject); }
+		for (const FLiveLinkAugmentaObject& AugmentaObject : PendingUpdatedObjects) { AddObject(AugmentaObject); }
+
+		for (const FLiveLinkAugmentaObject& AugmentaObject : PendingLeftObjects)
+		{
+			if (Region.ObjectIds.Remove(AugmentaObject.Id) > 0)
+			{
+				InterestLeftObjects.Add(AugmentaObject);
+			}
+		}
+
+		//Objects without events this frame enter or leave the node when its region changed
+		if (Region.bNeedsSync)
+		{
+			Region.bNeedsSync = false;
+
+			for (const TPair<int, FLiveLinkAugmentaObject>& TrackedObject : TrackedObjects)
+			{
+				if (InterestFrameObjectIds.Contains(TrackedObject.Key))
+				{
+					continue;
+				}
+
+				if (Region.Region.IsInside(FVector2D(TrackedObject.Value.Position)))
+				{
+					bool bIsAlreadyInRegion;
+					Region.ObjectIds.Add(TrackedObject.Key, &bIsAlreadyInRegion);
+
+					if (!bIsAlreadyInRegion)
+					{
+						InterestEnteredObjects.Add(TrackedObject.Value);
+					}
+				}
+				else if (Region.ObjectIds.Remove(TrackedObject.Key) > 0)
+				{
+					InterestLeftObjects.Add(TrackedObject.Value);
+				}
+			}
+		}
+
+		WriteInterestChunk(Writer, InterestRegion.Key, InterestEnteredObjects, InterestUpdatedObjects, InterestLeftObjects, Fields);
+	}
+
+	if (bHasDefaultChunk)
+	{
+		WriteInterestChunk(Writer, FString(), PendingEnteredObjects, PendingUpdatedObjects, PendingLeftObjects, Fields);
+	}
+}
+
+void ALiveLinkAugmentaClusterManager::WriteInterestChunk(FLiveLinkAugmentaClusterWriter& Writer, const FString& NodeId, const TArray<FLiveLinkAugmentaObject>& EnteredObjects,
+	const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects, EAugmentaClusterObjectFields Fields)
+{
+	//Chunks are prefixed with their size so that nodes skip the chunks of the others without decoding them
+	InterestChunkData.Reset();
+	FLiveLinkAugmentaClusterWriter ChunkWriter(InterestChunkData);
+
+	ChunkWriter.WriteVarUInt(EnteredObjects.Num());
+	ChunkWriter.WriteVarUInt(UpdatedObjects.Num());
+	ChunkWriter.WriteVarUInt(LeftObjects.Num());
+
+	for (const FLiveLinkAugmentaObject& AugmentaObject : EnteredObjects) { FLiveLinkAugmentaClusterCodec::WriteObject(ChunkWriter, AugmentaObject, Fields, Quantization); }
+	for (const FLiveLinkAugmentaObject& AugmentaObject : UpdatedObjects) { FLiveLinkAugmentaClusterCodec::WriteObject(ChunkWriter, AugmentaObject, Fields, Quantization); }
+	for (const FLiveLinkAugmentaObject& AugmentaObject : LeftObjects) { FLiveLinkAugmentaClusterCodec::WriteObject(ChunkWriter, AugmentaObject, Fields, Quantization); }
+
+	WriteNodeId(Writer, NodeId);
+	Writer.WriteVarUInt(InterestChunkData.Num());
+	Writer.WriteBytes(InterestChunkData.GetData(), InterestChunkData.Num());
+}
+
+void ALiveLinkAugmentaClusterManager::OnAugmentaSceneUpdated(const FLiveLinkAugmentaScene& AugmentaScene)
+{
+	Quantization = FLiveLinkAugmentaClusterQuantization::FromScene(AugmentaScene);
+
+	if (SyncObject)
+	{
+		SnapshotScene = AugmentaScene;
+		SceneRevision++;
+		bSnapshotChanged = true;
+		return;
+	}
+
+	if (bHasPendingScene)
+	{
+		CoalescedSceneUpdateCount++;
+	}
+
+	PendingScene = AugmentaScene;
+	bHasPendingScene = true;
+}
+
+void ALiveLinkAugmentaClusterManager::OnAugmentaVideoOutputUpdated(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput)
+{
+	if (SyncObject)
+	{
+		SnapshotVideoOutput = AugmentaVideoOutput;
+		VideoOutputRevision++;
+		bSnapshotChanged = true;
+		return;
+	}
+
+	if (bHasPendingVideoOutput)
+	{
+		CoalescedSceneUpdateCount++;
+	}
+
+	PendingVideoOutput = AugmentaVideoOutput;
+	bHasPendingVideoOutput = true;
+}
+
+void ALiveLinkAugmentaClusterManager::OnAugmentaFrame(const TArray<FLiveLinkAugmentaObject>& EnteredObjects, const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects)
+{
+	//Snapshots are built from the objects tracked by the Augmenta Event Dispatcher
+	if (SyncObject)
+	{
+		bSnapshotChanged = true;
+		return;
+	}
+
+	//The dispatcher may broadcast several frames between two cluster frames, only the latest state of each object is sent
+	for (const FLiveLinkAugmentaObject& AugmentaObject : EnteredObjects) { PendingEvents.Add(AugmentaObject.Id, 2, AugmentaObject); }
+	for (const FLiveLinkAugmentaObject& AugmentaObject : UpdatedObjects) { PendingEvents.Add(AugmentaObject.Id, 3, AugmentaObject); }
+	for (const FLiveLinkAugmentaObject& AugmentaObject : LeftObjects) { PendingEvents.Add(AugmentaObject.Id, 4, AugmentaObject); }
+
+	PendingUpdateEventCount += UpdatedObjects.Num();
+}
+
+void ALiveLinkAugmentaClusterManager::ResetPendingFrame()
+{
+	bHasPendingScene = false;
+	bHasPendingVideoOutput = false;
+	PendingEvents.Reset();
+	PendingUpdateEventCount = 0;
+	PendingEnteredObjects.Reset();
+	PendingUpdatedObjects.Reset();
+	PendingLeftObjects.Reset();
+}
+
+void ALiveLinkAugmentaClusterManager::BuildPendingFrame()
+{
+	SplitCoalescedEvents(PendingEvents, PendingEnteredObjects, PendingUpdatedObjects, PendingLeftObjects, DeferredPendingEvents);
+
+	LastFrameCoalescedUpdates = FMath::Max(PendingUpdateEventCount - PendingUpdatedObjects.Num(), 0);
+	CoalescedUpdateCount += LastFrameCoalescedUpdates;
+}
+
+void ALiveLinkAugmentaClusterManager::SplitCoalescedEvents(const FLiveLinkAugmentaEventCoalescer& Events, TArray<FLiveLinkAugmentaObject>& EnteredObjects,
+	TArray<FLiveLinkAugmentaObject>& UpdatedObjects, TArray<FLiveLinkAugmentaObject>& LeftObjects, TArray<FAugmentaCoalescedEvent>& DeferredEvents)
+{
+	EnteredObjects.Reset();
+	UpdatedObjects.Reset();
+	LeftObjects.Reset();
+	DeferredEvents.Reset();
+	CoalescedLeftIds.Reset();
+
+	for (const FAugmentaCoalescedEvent& Event : Events.GetEvents())
+	{
+		//Augmenta reuses the Ids, an object coming back during the frame may be another person: its new lifecycle waits for the next frame
+		if (Event.HasEntered() && CoalescedLeftIds.Contains(Event.ObjectId))
+		{
+			DeferredEvents.Add(Event);
+			continue;
+		}
+
+		//Objects entering and leaving during the frame get both events, as do objects entering and updated
+		if (Event.HasEntered())
+		{
+			EnteredObjects.Add(Event.AugmentaObject);
+		}
+
+		if (Event.HasUpdated() && !Event.HasLeft())
+		{
+			UpdatedObjects.Add(Event.AugmentaObject);
+		}
+
+		if (Event.HasLeft())
+		{
+			LeftObjects.Add(Event.AugmentaObject);
+			CoalescedLeftIds.Add(Event.ObjectId);
+		}
+	}
+}
+
+void ALiveLinkAugmentaClusterManager::SendFrameClusterEvent(bool bKeyframe)
+{
+	if (bKeyframe)
+	{
+		FramesSinceKeyframe = 0;
+	}
+
+	BuildPendingFrame();
+
+	FDisplayClusterClusterEventBinary Event;
+
+	Event.EventId = 6 + BinaryEventIdOffset;
+	SerializeBinaryAugmentaFrame(Event.EventData, bKeyframe);
+	Event.bIsSystemEvent = false;
+	Event.bShouldDiscardOnRepeat = false;
+
+	ClusterManager->EmitClusterEventBinary(Event, true);
+
+	ResetPendingFrame();
+
+	for (const FAugmentaCoalescedEvent& DeferredEvent : DeferredPendingEvents)
+	{
+		PendingEvents.Add(DeferredEvent);
+	}
+}
+
+void ALiveLinkAugmentaClusterManager::SendSceneUpdatedClusterEvent(const FLiveLinkAugmentaScene& AugmentaScene)
+{
+	Quantization = FLiveLinkAugmentaClusterQuantization::FromScene(AugmentaScene);
+
 	if(bUseBinaryClusterEvents)
 	{
 		FDisplayClusterClusterEventBinary Event;
@@ -104,7 +964,7 @@ void ALiveLinkAugmentaClusterManager::SendSceneUpdatedClusterEvent(const FLiveLi
 	}
 }
 
-void ALiveLinkAugmentaClusterManager::SendVideoOutputUpdatedClusterEvent(const FLiveLinkAugmentaVideoOutput AugmentaVideoOutput)
+void ALiveLinkAugmentaClusterManager::SendVideoOutputUpdatedClusterEvent(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput)
 {
 	if (bUseBinaryClusterEvents)
 	{
@@ -131,7 +991,7 @@ void ALiveLinkAugmentaClusterManager::SendVideoOutputUpdatedClusterEvent(const F
 	}
 }
 
-void ALiveLinkAugmentaClusterManager::SendObjectEnteredClusterEvent(const FLiveLinkAugmentaObject AugmentaObject)
+void ALiveLinkAugmentaClusterManager::SendObjectEnteredClusterEvent(const FLiveLinkAugmentaObject& AugmentaObject)
 {
 	if (bUseBinaryClusterEvents)
 	{
@@ -158,7 +1018,7 @@ void ALiveLinkAugmentaClusterManager::SendObjectEnteredClusterEvent(const FLiveL
 	}
 }
 
-void ALiveLinkAugmentaClusterManager::SendObjectUpdatedClusterEvent(const FLiveLinkAugmentaObject AugmentaObject)
+void ALiveLinkAugmentaClusterManager::SendObjectUpdatedClusterEvent(const FLiveLinkAugmentaObject& AugmentaObject)
 {
 	if(bUseBinaryClusterEvents)
 	{
@@ -185,7 +1045,7 @@ void ALiveLinkAugmentaClusterManager::SendObjectUpdatedClusterEvent(const FLiveL
 	}
 }
 
-void ALiveLinkAugmentaClusterManager::SendObjectLeftClusterEvent(const FLiveLinkAugmentaObject AugmentaObject)
+void ALiveLinkAugmentaClusterManager::SendObjectLeftClusterEvent(const FLiveLinkAugmentaObject& AugmentaObject)
 {
 	if(bUseBinaryClusterEvents)
 	{
@@ -214,6 +1074,35 @@ void ALiveLinkAugmentaClusterManager::SendObjectLeftClusterEvent(const FLiveLink
 
 void ALiveLinkAugmentaClusterManager::SendSourceDestroyedClusterEvent()
 {
+	//Objects of the destroyed source must not be sent after it
+	ResetPendingFrame();
+	LastSentStates.Reset();
+	bHasLastSentScene = false;
+
+	for (TPair<FString, FInterestRegion>& InterestRegion : InterestRegions)
+	{
+		InterestRegion.Value.ObjectIds.Reset();
+	}
+
+	bHasLastSentVideoOutput = false;
+
+	//Each node follows its own source
+	if (IngestManager)
+	{
+		bHasSelectedIngestFrame = false;
+		bHasPendingIngestFrame = false;
+		AppliedIngestVideoOutputRevision = 0;
+		BroadcastSourceDestroyed();
+		return;
+	}
+
+	if (SyncObject)
+	{
+		SourceDestroyedRevision++;
+		bSnapshotChanged = true;
+		return;
+	}
+
 	if (bUseBinaryClusterEvents)
 	{
 		FDisplayClusterClusterEventBinary Event;
@@ -241,26 +1130,33 @@ void ALiveLinkAugmentaClusterManager::OnClusterEventJson_Implementation(const FD
 {
 	if (Event.Name == "SceneUpdated")
 	{
-		OnAugmentaSceneUpdated.Broadcast(DeserializeJsonAugmentaScene(Event.Parameters));
+		ReceiveSceneUpdated(DeserializeJsonAugmentaScene(Event.Parameters));
 	} else if(Event.Name == "VideoOutputUpdated")
 	{
-		OnAugmentaVideoOutputUpdated.Broadcast(DeserializeJsonAugmentaVideoOutput(Event.Parameters));
+		ReceiveVideoOutputUpdated(DeserializeJsonAugmentaVideoOutput(Event.Parameters));
 	}
 	else if (Event.Name == "ObjectEntered")
 	{
-		OnAugmentaObjectEntered.Broadcast(DeserializeJsonAugmentaObject(Event.Parameters));
+		ReceiveObjectEvent(2, DeserializeJsonAugmentaObject(Event.Parameters));
 	}
 	else if (Event.Name == "ObjectUpdated")
 	{
-		OnAugmentaObjectUpdated.Broadcast(DeserializeJsonAugmentaObject(Event.Parameters));
+		ReceiveObjectEvent(3, DeserializeJsonAugmentaObject(Event.Parameters));
 	}
 	else if (Event.Name == "ObjectLeft")
 	{
-		OnAugmentaObjectLeft.Broadcast(DeserializeJsonAugmentaObject(Event.Parameters));
+		ReceiveObjectEvent(4, DeserializeJsonAugmentaObject(Event.Parameters));
 	}
 	else if (Event.Name == "SourceDestroyed")
 	{
-		OnAugmentaSourceDestroyed.Broadcast();
+		//The events received before are still dispatched, including the objects that came back during the last frame
+		do
+		{
+			FlushReceivedEvents();
+		}
+		while (ReceivedEvents.Num() > 0);
+
+		BroadcastSourceDestroyed();
 	}
 }
 
@@ -269,27 +1165,59 @@ void ALiveLinkAugmentaClusterManager::OnClusterEventBinary_Implementation(
 {
 	if (Event.EventId == BinaryEventIdOffset)
 	{
-		OnAugmentaSourceDestroyed.Broadcast();
+		//The events received before are still dispatched, including the objects that came back during the last frame
+		do
+		{
+			FlushReceivedEvents();
+		}
+		while (ReceivedEvents.Num() > 0);
+
+		BroadcastSourceDestroyed();
 	}
 	else if(Event.EventId == BinaryEventIdOffset + 1)
 	{
-		OnAugmentaSceneUpdated.Broadcast(DeserializeBinaryAugmentaScene(Event.EventData));
+		FLiveLinkAugmentaScene AugmentaScene;
+		if (DeserializeBinaryAugmentaScene(Event.EventData, AugmentaScene))
+		{
+			ReceiveSceneUpdated(AugmentaScene);
+		}
 	}
 	else if (Event.EventId == BinaryEventIdOffset + 2)
 	{
-		OnAugmentaVideoOutputUpdated.Broadcast(DeserializeBinaryAugmentaVideoOutput(Event.EventData));
+		FLiveLinkAugmentaVideoOutput AugmentaVideoOutput;
+		if (DeserializeBinaryAugmentaVideoOutput(Event.EventData, AugmentaVideoOutput))
+		{
+			ReceiveVideoOutputUpdated(AugmentaVideoOutput);
+		}
+	}
+	else if (Event.EventId >= BinaryEventIdOffset + 3 && Event.EventId <= BinaryEventIdOffset + 5)
+	{
+		//Object event ids follow the Augmenta event types, decoded in place
+		if (DeserializeBinaryAugmentaObject(Event.EventData, ReceivedObject))
+		{
+			ReceiveObjectEvent(Event.EventId - BinaryEventIdOffset - 1, ReceivedObject);
+		}
 	}
-	else if (Event.EventId == BinaryEventIdOffset + 3)
+	else if (Event.EventId == BinaryEventIdOffset + 6)
 	{
-		OnAugmentaObjectEntered.Broadcast(DeserializeBinaryAugmentaObject(Event.EventData));
+		ApplyBinaryAugmentaFrame(Event.EventData);
 	}
-	else if (Event.EventId == BinaryEventIdOffset + 4)
+	else if (Event.EventId == BinaryEventIdOffset + 8)
 	{
-		OnAugmentaObjectUpdated.Broadcast(DeserializeBinaryAugmentaObject(Event.EventData));
+		OnInterestRegionReceived(Event.EventData);
 	}
-	else if (Event.EventId == BinaryEventIdOffset + 5)
+	else if (Event.EventId == BinaryEventIdOffset + 7 && IngestManager)
 	{
-		OnAugmentaObjectLeft.Broadcast(DeserializeBinaryAugmentaObject(Event.EventData));
+		FLiveLinkAugmentaClusterReader Reader(Event.EventData);
+		const int32 Frame = (int32)Reader.ReadUInt32();
+
+		if (!Reader.HasError())
+		{
+			//A frame not applied yet is replaced by the newer selection
+			PendingIngestFrame = Frame;
+			bHasPendingIngestFrame = true;
+			ApplyIngestFrame();
+		}
 	}
 }
 
@@ -301,21 +1229,7 @@ TMap<FString, FString> ALiveLinkAugmentaClusterManager::SerializeJsonAugmentaSce
 {
 	TMap<FString, FString> EventData;
 
-	EventData.Add("Frame", FString::FromInt(AugmentaScene.Frame));
-	EventData.Add("ObjectCount", FString::FromInt(AugmentaScene.ObjectCount));
-	EventData.Add("SizeX", FString::SanitizeFloat(AugmentaScene.Size.X));
-	EventData.Add("SizeY", FString::SanitizeFloat(AugmentaScene.Size.Y));
-
-	EventData.Add("PositionX", FString::SanitizeFloat(AugmentaScene.Position.X));
-	EventData.Add("PositionY", FString::SanitizeFloat(AugmentaScene.Position.Y));
-	EventData.Add("PositionZ", FString::SanitizeFloat(AugmentaScene.Position.Z));
-	EventData.Add("RotationX", FString::SanitizeFloat(AugmentaScene.Rotation.X));
-	EventData.Add("RotationY", FString::SanitizeFloat(AugmentaScene.Rotation.Y));
-	EventData.Add("RotationZ", FString::SanitizeFloat(AugmentaScene.Rotation.Z));
-	EventData.Add("RotationW", FString::SanitizeFloat(AugmentaScene.Rotation.W));
-	EventData.Add("ScaleX", FString::SanitizeFloat(AugmentaScene.Scale.X));
-	EventData.Add("ScaleY", FString::SanitizeFloat(AugmentaScene.Scale.Y));
-	EventData.Add("ScaleZ", FString::SanitizeFloat(AugmentaScene.Scale.Z));
+	FLiveLinkAugmentaClusterJsonCodec::WriteScene(AugmentaScene, EventData);
 
 	return EventData;
 }
@@ -324,21 +1238,10 @@ FLiveLinkAugmentaScene ALiveLinkAugmentaClusterManager::DeserializeJsonAugmentaS
 {
 	FLiveLinkAugmentaScene AugmentaScene;
 
-	FString TmpString = *EventData.Find("Frame");	AugmentaScene.Frame = FCString::Atoi(*TmpString);
-	TmpString = *EventData.Find("ObjectCount"); AugmentaScene.ObjectCount = FCString::Atoi(*TmpString);
-	TmpString = *EventData.Find("SizeX");	AugmentaScene.Size.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("SizeY");	AugmentaScene.Size.Y = FCString::Atod(*TmpString);
-
-	TmpString = *EventData.Find("PositionX");	AugmentaScene.Position.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("PositionY");	AugmentaScene.Position.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("PositionZ");	AugmentaScene.Position.Z = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationX");	AugmentaScene.Rotation.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationY");	AugmentaScene.Rotation.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationZ");	AugmentaScene.Rotation.Z = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationW");	AugmentaScene.Rotation.W = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("ScaleX"); AugmentaScene.Scale.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("ScaleY");	 AugmentaScene.Scale.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("ScaleZ");	 AugmentaScene.Scale.Z = FCString::Atod(*TmpString);
+	if (!FLiveLinkAugmentaClusterJsonCodec::ReadScene(EventData, AugmentaScene))
+	{
+		UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("Augmenta Cluster Manager: Missing fields in scene cluster event, they keep their default value."));
+	}
 
 	return AugmentaScene;
 }
@@ -348,23 +1251,7 @@ TMap<FString, FString> ALiveLinkAugmentaClusterManager::SerializeJsonAugmentaVid
 {
 	TMap<FString, FString> EventData;
 
-	EventData.Add("OffsetX", FString::SanitizeFloat(AugmentaVideoOutput.Offset.X));
-	EventData.Add("OffsetY", FString::SanitizeFloat(AugmentaVideoOutput.Offset.Y));
-	EventData.Add("SizeX", FString::SanitizeFloat(AugmentaVideoOutput.Size.X));
-	EventData.Add("SizeY", FString::SanitizeFloat(AugmentaVideoOutput.Size.Y));
-	EventData.Add("ResolutionX", FString::FromInt(AugmentaVideoOutput.Resolution.X));
-	EventData.Add("ResolutionY", FString::FromInt(AugmentaVideoOutput.Resolution.Y));
-
-	EventData.Add("PositionX", FString::SanitizeFloat(AugmentaVideoOutput.Position.X));
-	EventData.Add("PositionY", FString::SanitizeFloat(AugmentaVideoOutput.Position.Y));
-	EventData.Add("PositionZ", FString::SanitizeFloat(AugmentaVideoOutput.Position.Z));
-	EventData.Add("RotationX", FString::SanitizeFloat(AugmentaVideoOutput.Rotation.X));
-	EventData.Add("RotationY", FString::SanitizeFloat(AugmentaVideoOutput.Rotation.Y));
-	EventData.Add("RotationZ", FString::SanitizeFloat(AugmentaVideoOutput.Rotation.Z));
-	EventData.Add("RotationW", FString::SanitizeFloat(AugmentaVideoOutput.Rotation.W));
-	EventData.Add("ScaleX", FString::SanitizeFloat(AugmentaVideoOutput.Scale.X));
-	EventData.Add("ScaleY", FString::SanitizeFloat(AugmentaVideoOutput.Scale.Y));
-	EventData.Add("ScaleZ", FString::SanitizeFloat(AugmentaVideoOutput.Scale.Z));
+	FLiveLinkAugmentaClusterJsonCodec::WriteVideoOutput(AugmentaVideoOutput, EventData);
 
 	return EventData;
 }
@@ -374,23 +1261,10 @@ FLiveLinkAugmentaVideoOutput ALiveLinkAugmentaClusterManager::DeserializeJsonAug
 {
 	FLiveLinkAugmentaVideoOutput AugmentaVideoOutput;
 
-	FString TmpString = *EventData.Find("OffsetX"); AugmentaVideoOutput.Offset.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("OffsetY"); AugmentaVideoOutput.Offset.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("SizeX");	AugmentaVideoOutput.Size.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("SizeY");	AugmentaVideoOutput.Size.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("ResolutionX"); AugmentaVideoOutput.Resolution.X = FCString::Atoi(*TmpString);
-	TmpString = *EventData.Find("ResolutionY"); AugmentaVideoOutput.Resolution.Y = FCString::Atoi(*TmpString);
-
-	TmpString = *EventData.Find("PositionX");	AugmentaVideoOutput.Position.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("PositionY");	AugmentaVideoOutput.Position.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("PositionZ");	AugmentaVideoOutput.Position.Z = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationX");	AugmentaVideoOutput.Rotation.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationY");	AugmentaVideoOutput.Rotation.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationZ");	AugmentaVideoOutput.Rotation.Z = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationW");	AugmentaVideoOutput.Rotation.W = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("ScaleX"); AugmentaVideoOutput.Scale.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("ScaleY");	 AugmentaVideoOutput.Scale.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("ScaleZ");	 AugmentaVideoOutput.Scale.Z = FCString::Atod(*TmpString);
+	if (!FLiveLinkAugmentaClusterJsonCodec::ReadVideoOutput(EventData, AugmentaVideoOutput))
+	{
+		UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("Augmenta Cluster Manager: Missing fields in video output cluster event, they keep their default value."));
+	}
 
 	return AugmentaVideoOutput;
 }
@@ -400,45 +1274,7 @@ TMap<FString, FString> ALiveLinkAugmentaClusterManager::SerializeJsonAugmentaObj
 {
 	TMap<FString, FString> EventData;
 
-	EventData.Add("Id", FString::FromInt(AugmentaObject.Id));
-	EventData.Add("Age", FString::SanitizeFloat(AugmentaObject.Age));
-	EventData.Add("PositionX", FString::SanitizeFloat(AugmentaObject.Position.X));
-	EventData.Add("PositionY", FString::SanitizeFloat(AugmentaObject.Position.Y));
-	EventData.Add("PositionZ", FString::SanitizeFloat(AugmentaObject.Position.Z));
-	EventData.Add("RotationX", FString::SanitizeFloat(AugmentaObject.Rotation.X));
-	EventData.Add("RotationY", FString::SanitizeFloat(AugmentaObject.Rotation.Y));
-	EventData.Add("RotationZ", FString::SanitizeFloat(AugmentaObject.Rotation.Z));
-	EventData.Add("RotationW", FString::SanitizeFloat(AugmentaObject.Rotation.W));
-	EventData.Add("ScaleX", FString::SanitizeFloat(AugmentaObject.Scale.X));
-	EventData.Add("ScaleY", FString::SanitizeFloat(AugmentaObject.Scale.Y));
-	EventData.Add("ScaleZ", FString::SanitizeFloat(AugmentaObject.Scale.Z));
-
-	if (!bSendReducedObjectData) {
-		EventData.Add("Frame", FString::FromInt(AugmentaObject.Frame));
-		EventData.Add("Oid", FString::FromInt(AugmentaObject.Oid));
-		EventData.Add("CentroidX", FString::SanitizeFloat(AugmentaObject.Centroid.X));
-		EventData.Add("CentroidY", FString::SanitizeFloat(AugmentaObject.Centroid.Y));
-		EventData.Add("VelocityX", FString::SanitizeFloat(AugmentaObject.Velocity.X));
-		EventData.Add("VelocityY", FString::SanitizeFloat(AugmentaObject.Velocity.Y));
-		EventData.Add("Orientation", FString::SanitizeFloat(AugmentaObject.Orientation));
-		EventData.Add("BoundingRectPosX", FString::SanitizeFloat(AugmentaObject.BoundingRectPos.X));
-		EventData.Add("BoundingRectPosY", FString::SanitizeFloat(AugmentaObject.BoundingRectPos.Y));
-		EventData.Add("BoundingRectSizeX", FString::SanitizeFloat(AugmentaObject.BoundingRectSize.X));
-		EventData.Add("BoundingRectSizeY", FString::SanitizeFloat(AugmentaObject.BoundingRectSize.Y));
-		EventData.Add("BoundingRectRotation", FString::SanitizeFloat(AugmentaObject.BoundingRectRotation));
-		EventData.Add("Height", FString::SanitizeFloat(AugmentaObject.Height));
-		EventData.Add("HighestX", FString::SanitizeFloat(AugmentaObject.Highest.X));
-		EventData.Add("HighestY", FString::SanitizeFloat(AugmentaObject.Highest.Y));
-		EventData.Add("Distance", FString::SanitizeFloat(AugmentaObject.Distance));
-		EventData.Add("Reflectivity", FString::SanitizeFloat(AugmentaObject.Reflectivity));
-		EventData.Add("LastUpdateTimeYear", FString::FromInt(AugmentaObject.LastUpdateTime.GetYear()));
-		EventData.Add("LastUpdateTimeMonth", FString::FromInt(AugmentaObject.LastUpdateTime.GetMonth()));
-		EventData.Add("LastUpdateTimeDay", FString::FromInt(AugmentaObject.LastUpdateTime.GetDay()));
-		EventData.Add("LastUpdateTimeHour", FString::FromInt(AugmentaObject.LastUpdateTime.GetHour()));
-		EventData.Add("LastUpdateTimeMinute", FString::FromInt(AugmentaObject.LastUpdateTime.GetMinute()));
-		EventData.Add("LastUpdateTimeSecond", FString::FromInt(AugmentaObject.LastUpdateTime.GetSecond()));
-		EventData.Add("LastUpdateTimeMillisecond", FString::FromInt(AugmentaObject.LastUpdateTime.GetMillisecond()));
-	}
+	FLiveLinkAugmentaClusterJsonCodec::WriteObject(AugmentaObject, bSendReducedObjectData, EventData);
 
 	return EventData;
 }
@@ -448,47 +1284,10 @@ FLiveLinkAugmentaObject ALiveLinkAugmentaClusterManager::DeserializeJsonAugmenta
 {
 	FLiveLinkAugmentaObject AugmentaObject;
 
-	FString TmpString = *EventData.Find("Id");	 AugmentaObject.Id = FCString::Atoi(*TmpString);
-	TmpString = *EventData.Find("Age"); AugmentaObject.Age = FCString::Atof(*TmpString);
-	TmpString = *EventData.Find("PositionX");		AugmentaObject.Position.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("PositionY");		AugmentaObject.Position.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("PositionZ");		AugmentaObject.Position.Z = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationX");		AugmentaObject.Rotation.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationY");		AugmentaObject.Rotation.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationZ");		AugmentaObject.Rotation.Z = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("RotationW");		AugmentaObject.Rotation.W = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("ScaleX");			AugmentaObject.Scale.X = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("ScaleY");			AugmentaObject.Scale.Y = FCString::Atod(*TmpString);
-	TmpString = *EventData.Find("ScaleZ");			AugmentaObject.Scale.Z = FCString::Atod(*TmpString);
-
-	if (!bSendReducedObjectData) {
-		TmpString = *EventData.Find("Frame");	AugmentaObject.Frame = FCString::Atoi(*TmpString);
-		TmpString = *EventData.Find("Oid"); AugmentaObject.Oid = FCString::Atoi(*TmpString);
-		TmpString = *EventData.Find("CentroidX");	AugmentaObject.Centroid.X = FCString::Atod(*TmpString);
-		TmpString = *EventData.Find("CentroidY");	AugmentaObject.Centroid.Y = FCString::Atod(*TmpString);
-		TmpString = *EventData.Find("VelocityX");	AugmentaObject.Velocity.X = FCString::Atod(*TmpString);
-		TmpString = *EventData.Find("VelocityY");	AugmentaObject.Velocity.Y = FCString::Atod(*TmpString);
-		TmpString = *EventData.Find("Orientation"); AugmentaObject.Orientation = FCString::Atof(*TmpString);
-		TmpString = *EventData.Find("BoundingRectPosX"); AugmentaObject.BoundingRectPos.X = FCString::Atod(*TmpString);
-		TmpString = *EventData.Find("BoundingRectPosY"); AugmentaObject.BoundingRectPos.Y = FCString::Atod(*TmpString);
-		TmpString = *EventData.Find("BoundingRectSizeX"); AugmentaObject.BoundingRectSize.X = FCString::Atod(*TmpString);
-		TmpString = *EventData.Find("BoundingRectSizeY");	AugmentaObject.BoundingRectSize.Y = FCString::Atod(*TmpString);
-		TmpString = *EventData.Find("BoundingRectRotation"); AugmentaObject.BoundingRectRotation = FCString::Atof(*TmpString);
-		TmpString = *EventData.Find("Height"); AugmentaObject.Height = FCString::Atof(*TmpString);
-		TmpString = *EventData.Find("HighestX"); AugmentaObject.Highest.X = FCString::Atod(*TmpString);
-		TmpString = *EventData.Find("HighestY"); AugmentaObject.Highest.Y = FCString::Atod(*TmpString);
-		TmpString = *EventData.Find("Distance"); AugmentaObject.Distance = FCString::Atof(*TmpString);
-		TmpString = *EventData.Find("Reflectivity"); AugmentaObject.Reflectivity = FCString::Atof(*TmpString);
-
-		TmpString = *EventData.Find("LastUpdateTimeYear"); int Year = FCString::Atoi(*TmpString);
-		TmpString = *EventData.Find("LastUpdateTimeMonth"); int Month = FCString::Atoi(*TmpString);
-		TmpString = *EventData.Find("LastUpdateTimeDay"); int Day = FCString::Atoi(*TmpString);
-		TmpString = *EventData.Find("LastUpdateTimeHour"); int Hour = FCString::Atoi(*TmpString);
-		TmpString = *EventData.Find("LastUpdateTimeMinute"); int Minute = FCString::Atoi(*TmpString);
-		TmpString = *EventData.Find("LastUpdateTimeSecond"); int Second = FCString::Atoi(*TmpString);
-		TmpString = *EventData.Find("LastUpdateTimeMillisecond"); int Millisecond = FCString::Atoi(*TmpString);
-		FDateTime LastUpdateTime{ Year, Month, Day, Hour, Minute, Second, Millisecond };
-		AugmentaObject.LastUpdateTime = LastUpdateTime;
+	//Extended fields are optional, whatever bSendReducedObjectData is on the sending node
+	if (!FLiveLinkAugmentaClusterJsonCodec::ReadObject(EventData, AugmentaObject))
+	{
+		UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("Augmenta Cluster Manager: Missing fields in object cluster event, they keep their default value."));
 	}
 
 	return AugmentaObject;
@@ -503,6 +1302,15 @@ TArray<uint8> ALiveLinkAugmentaClusterManager::SerializeBinaryAugmentaScene(cons
 {
 	TArray<uint8> EventData;
 
+	if (WireFormat == EAugmentaClusterWireFormat::Compact)
+	{
+		FLiveLinkAugmentaClusterWriter Writer(EventData);
+		FLiveLinkAugmentaClusterCodec::WriteVersion(Writer);
+		FLiveLinkAugmentaClusterCodec::WriteScene(Writer, AugmentaScene);
+
+		return EventData;
+	}
+
 	// Allocate buffer memory
 	const uint32 BufferSize = sizeof(AugmentaScene);
 	EventData.SetNumUninitialized(BufferSize);
@@ -512,13 +1320,25 @@ TArray<uint8> ALiveLinkAugmentaClusterManager::SerializeBinaryAugmentaScene(cons
 	return EventData;
 }
 
-FLiveLinkAugmentaScene ALiveLinkAugmentaClusterManager::DeserializeBinaryAugmentaScene(const TArray<uint8> EventData)
+bool ALiveLinkAugmentaClusterManager::DeserializeBinaryAugmentaScene(const TArray<uint8>& EventData, FLiveLinkAugmentaScene& AugmentaScene)
 {
-	FLiveLinkAugmentaScene AugmentaScene;
+	if (WireFormat == EAugmentaClusterWireFormat::Compact)
+	{
+		FLiveLinkAugmentaClusterReader Reader(EventData);
+		FLiveLinkAugmentaClusterCodec::ReadVersion(Reader);
+		FLiveLinkAugmentaClusterCodec::ReadScene(Reader, AugmentaScene);
+
+		return !Reader.HasError();
+	}
+
+	if (EventData.Num() != sizeof(AugmentaScene))
+	{
+		return false;
+	}
 
 	FMemory::Memcpy(&AugmentaScene, EventData.GetData(), sizeof(AugmentaScene));
 
-	return AugmentaScene;
+	return true;
 }
 
 TArray<uint8> ALiveLinkAugmentaClusterManager::SerializeBinaryAugmentaVideoOutput(
@@ -526,6 +1346,15 @@ TArray<uint8> ALiveLinkAugmentaClusterManager::SerializeBinaryAugmentaVideoOutpu
 {
 	TArray<uint8> EventData;
 
+	if (WireFormat == EAugmentaClusterWireFormat::Compact)
+	{
+		FLiveLinkAugmentaClusterWriter Writer(EventData);
+		FLiveLinkAugmentaClusterCodec::WriteVersion(Writer);
+		FLiveLinkAugmentaClusterCodec::WriteVideoOutput(Writer, AugmentaVideoOutput);
+
+		return EventData;
+	}
+
 	// Allocate buffer memory
 	const uint32 BufferSize = sizeof(AugmentaVideoOutput);
 	EventData.SetNumUninitialized(BufferSize);
@@ -535,14 +1364,26 @@ TArray<uint8> ALiveLinkAugmentaClusterManager::SerializeBinaryAugmentaVideoOutpu
 	return EventData;
 }
 
-FLiveLinkAugmentaVideoOutput ALiveLinkAugmentaClusterManager::DeserializeBinaryAugmentaVideoOutput(
-	const TArray<uint8> EventData)
+bool ALiveLinkAugmentaClusterManager::DeserializeBinaryAugmentaVideoOutput(
+	const TArray<uint8>& EventData, FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput)
 {
-	FLiveLinkAugmentaVideoOutput AugmentaVideoOutput;
+	if (WireFormat == EAugmentaClusterWireFormat::Compact)
+	{
+		FLiveLinkAugmentaClusterReader Reader(EventData);
+		FLiveLinkAugmentaClusterCodec::ReadVersion(Reader);
+		FLiveLinkAugmentaClusterCodec::ReadVideoOutput(Reader, AugmentaVideoOutput);
+
+		return !Reader.HasError();
+	}
+
+	if (EventData.Num() != sizeof(AugmentaVideoOutput))
+	{
+		return false;
+	}
 
 	FMemory::Memcpy(&AugmentaVideoOutput, EventData.GetData(), sizeof(AugmentaVideoOutput));
 
-	return AugmentaVideoOutput;
+	return true;
 }
 
 TArray<uint8> ALiveLinkAugmentaClusterManager::SerializeBinaryAugmentaObject(
@@ -550,6 +1391,16 @@ TArray<uint8> ALiveLinkAugmentaClusterManager::SerializeBinaryAugmentaObject(
 {
 	TArray<uint8> EventData;
 
+	if (WireFormat == EAugmentaClusterWireFormat::Compact)
+	{
+		FLiveLinkAugmentaClusterWriter Writer(EventData);
+		FLiveLinkAugmentaClusterCodec::WriteVersion(Writer);
+		FLiveLinkAugmentaClusterCodec::WriteQuantization(Writer, Quantization);
+		FLiveLinkAugmentaClusterCodec::WriteObject(Writer, AugmentaObject, FLiveLinkAugmentaClusterCodec::GetObjectFields(bSendReducedObjectData), Quantization);
+
+		return EventData;
+	}
+
 	// Allocate buffer memory
 	const uint32 BufferSize = sizeof(AugmentaObject);
 	EventData.SetNumUninitialized(BufferSize);
@@ -559,14 +1410,563 @@ TArray<uint8> ALiveLinkAugmentaClusterManager::SerializeBinaryAugmentaObject(
 	return EventData;
 }
 
-FLiveLinkAugmentaObject ALiveLinkAugmentaClusterManager::DeserializeBinaryAugmentaObject(const TArray<uint8> EventData)
+bool ALiveLinkAugmentaClusterManager::DeserializeBinaryAugmentaObject(const TArray<uint8>& EventData, FLiveLinkAugmentaObject& AugmentaObject)
 {
-	FLiveLinkAugmentaObject AugmentaObject;
+	if (WireFormat == EAugmentaClusterWireFormat::Compact)
+	{
+		FLiveLinkAugmentaClusterReader Reader(EventData);
+		FLiveLinkAugmentaClusterQuantization ReceivedQuantization;
+
+		FLiveLinkAugmentaClusterCodec::ReadVersion(Reader);
+		FLiveLinkAugmentaClusterCodec::ReadQuantization(Reader, ReceivedQuantization);
+		FLiveLinkAugmentaClusterCodec::ReadObject(Reader, AugmentaObject, ReceivedQuantization);
+
+		return !Reader.HasError();
+	}
+
+	if (EventData.Num() != sizeof(AugmentaObject))
+	{
+		return false;
+	}
 
 	FMemory::Memcpy(&AugmentaObject, EventData.GetData(), sizeof(AugmentaObject));
 
-	return AugmentaObject;
+	return true;
+}
+
+void ALiveLinkAugmentaClusterManager::SerializeBinaryAugmentaFrame(TArray<uint8>& EventData, bool bKeyframe)
+{
+	if (bHasPendingScene) { LastSentScene = PendingScene; bHasLastSentScene = true; }
+	if (bHasPendingVideoOutput) { LastSentVideoOutput = PendingVideoOutput; bHasLastSentVideoOutput = true; }
+
+	//Keyframes repeat the scene and video output for the nodes that missed them
+	const bool bSendScene = bHasPendingScene || (bKeyframe && bHasLastSentScene);
+	const bool bSendVideoOutput = bHasPendingVideoOutput || (bKeyframe && bHasLastSentVideoOutput);
+
+	FAugmentaFrameBatchHeader Header;
+	Header.Flags = EAugmentaFrameBatchFlags::None;
+	Header.EnteredObjectCount = PendingEnteredObjects.Num();
+	Header.UpdatedObjectCount = PendingUpdatedObjects.Num();
+	Header.LeftObjectCount = PendingLeftObjects.Num();
+
+	if (bSendScene) { Header.Flags |= EAugmentaFrameBatchFlags::HasScene; }
+	if (bSendVideoOutput) { Header.Flags |= EAugmentaFrameBatchFlags::HasVideoOutput; }
+
+	if (WireFormat == EAugmentaClusterWireFormat::Compact)
+	{
+		const EAugmentaClusterObjectFields Fields = FLiveLinkAugmentaClusterCodec::GetObjectFields(bSendReducedObjectData);
+		const bool bDelta = IsDeltaCompressionActive();
+
+		if (bDelta) { Header.Flags |= EAugmentaFrameBatchFlags::Delta; }
+		if (bDelta && bKeyframe) { Header.Flags |= EAugmentaFrameBatchFlags::Keyframe; }
+		if (IsInterestManagementActive()) { Header.Flags |= EAugmentaFrameBatchFlags::InterestChunks; }
+
+		FLiveLinkAugmentaClusterWriter Writer(EventData);
+		FLiveLinkAugmentaClusterCodec::WriteVersion(Writer);
+		Writer.WriteUInt8((uint8)Header.Flags);
+
+		if (bSendScene) { FLiveLinkAugmentaClusterCodec::WriteScene(Writer, bHasPendingScene ? PendingScene : LastSentScene); }
+		if (bSendVideoOutput) { FLiveLinkAugmentaClusterCodec::WriteVideoOutput(Writer, bHasPendingVideoOutput ? PendingVideoOutput : LastSentVideoOutput); }
+
+		FLiveLinkAugmentaClusterCodec::WriteQuantization(Writer, Quantization);
+
+		if (EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::InterestChunks))
+		{
+			WriteInterestChunks(Writer, Fields);
+			return;
+		}
+
+		Writer.WriteVarUInt(Header.EnteredObjectCount);
+		Writer.WriteVarUInt(Header.UpdatedObjectCount);
+		Writer.WriteVarUInt(Header.LeftObjectCount);
+
+		if (!bDelta)
+		{
+			for (const FLiveLinkAugmentaObject& AugmentaObject : PendingEnteredObjects) { FLiveLinkAugmentaClusterCodec::WriteObject(Writer, AugmentaObject, Fields, Quantization); }
+			for (const FLiveLinkAugmentaObject& AugmentaObject : PendingUpdatedObjects) { FLiveLinkAugmentaClusterCodec::WriteObject(Writer, AugmentaObject, Fields, Quantization); }
+			for (const FLiveLinkAugmentaObject& AugmentaObject : PendingLeftObjects) { FLiveLinkAugmentaClusterCodec::WriteObject(Writer, AugmentaObject, Fields, Quantization); }
+
+			return;
+		}
+
+		int BytesSaved = 0;
+
+		for (const FLiveLinkAugmentaObject& AugmentaObject : PendingEnteredObjects)
+		{
+			FLiveLinkAugmentaClusterCodec::WriteObject(Writer, AugmentaObject, Fields, Quantization);
+			LastSentStates.Add(AugmentaObject.Id, AugmentaObject);
+		}
+
+		for (const FLiveLinkAugmentaObject& AugmentaObject : PendingUpdatedObjects)
+		{
+			const FLiveLinkAugmentaObject* LastSentState = LastSentStates.Find(AugmentaObject.Id);
+			const EAugmentaClusterObjectFields ChangedFields = (LastSentState && !bKeyframe) ? FLiveLinkAugmentaClusterCodec::GetChangedFields(*LastSentState, AugmentaObject, Quantization) & Fields : Fields;
+
+			FLiveLinkAugmentaClusterCodec::WriteObject(Writer, AugmentaObject, ChangedFields, Quantization);
+			BytesSaved += FLiveLinkAugmentaClusterCodec::GetObjectSize(AugmentaObject, Fields) - FLiveLinkAugmentaClusterCodec::GetObjectSize(AugmentaObject, ChangedFields);
+
+			LastSentStates.Add(AugmentaObject.Id, AugmentaObject);
+		}
+
+		//Receivers know the state of the objects leaving
+		for (const FLiveLinkAugmentaObject& AugmentaObject : PendingLeftObjects)
+		{
+			FLiveLinkAugmentaClusterCodec::WriteObject(Writer, AugmentaObject, EAugmentaClusterObjectFields::None, Quantization);
+			BytesSaved += FLiveLinkAugmentaClusterCodec::GetObjectSize(AugmentaObject, Fields) - FLiveLinkAugmentaClusterCodec::GetObjectSize(AugmentaObject, EAugmentaClusterObjectFields::None);
+
+			LastSentStates.Remove(AugmentaObject.Id);
+		}
+
+		if (bKeyframe)
+		{
+			//The objects of this frame were already sent with all their fields
+			KeyframeObjectIds.Reset();
+
+			for (const FLiveLinkAugmentaObject& AugmentaObject : PendingEnteredObjects) { KeyframeObjectIds.Add(AugmentaObject.Id); }
+			for (const FLiveLinkAugmentaObject& AugmentaObject : PendingUpdatedObjects) { KeyframeObjectIds.Add(AugmentaObject.Id); }
+
+			KeyframeObjects.Reset();
+
+			for (const TPair<int, FLiveLinkAugmentaObject>& LastSentState : LastSentStates)
+			{
+				if (!KeyframeObjectIds.Contains(LastSentState.Key))
+				{
+					KeyframeObjects.Add(&LastSentState.Value);
+				}
+			}
+
+			const int32 KeyframeStart = EventData.Num();
+
+			Writer.WriteVarUInt(KeyframeObjects.Num());
+
+			for (const FLiveLinkAugmentaObject* AugmentaObject : KeyframeObjects)
+			{
+				FLiveLinkAugmentaClusterCodec::WriteObject(Writer, *AugmentaObject, Fields, Quantization);
+			}
+
+			BytesSaved -= EventData.Num() - KeyframeStart;
+		}
+
+		LastFrameBytes = EventData.Num();
+		LastFrameFullBytes = LastFrameBytes + BytesSaved;
+
+		TotalBytesSaved += BytesSaved;
+		DeltaFrameCount++;
+		AverageBytesSavedPerFrame = (float)((double)TotalBytesSaved / DeltaFrameCount);
+
+		return;
+	}
+
+	// Allocate buffer memory
+	const int32 BufferSize = sizeof(Header)
+		+ (bHasPendingScene ? sizeof(FLiveLinkAugmentaScene) : 0)
+		+ (bHasPendingVideoOutput ? sizeof(FLiveLinkAugmentaVideoOutput) : 0)
+		+ (Header.EnteredObjectCount + Header.UpdatedObjectCount + Header.LeftObjectCount) * sizeof(FLiveLinkAugmentaObject);
+	EventData.SetNumUninitialized(BufferSize);
+
+	uint8* Cursor = EventData.GetData();
+
+	WriteBinary(Cursor, Header);
+	if (bHasPendingScene) { WriteBinary(Cursor, PendingScene); }
+	if (bHasPendingVideoOutput) { WriteBinary(Cursor, PendingVideoOutput); }
+	WriteBinaryObjects(Cursor, PendingEnteredObjects);
+	WriteBinaryObjects(Cursor, PendingUpdatedObjects);
+	WriteBinaryObjects(Cursor, PendingLeftObjects);
+}
+
+void ALiveLinkAugmentaClusterManager::ApplyBinaryAugmentaFrame(const TArray<uint8>& EventData)
+{
+	FAugmentaFrameBatchHeader Header;
+	FLiveLinkAugmentaScene AugmentaScene;
+	FLiveLinkAugmentaVideoOutput AugmentaVideoOutput;
+	bool bIsValid;
+
+	//Decode the whole frame before applying it so that a truncated event is ignored entirely
+	if (WireFormat == EAugmentaClusterWireFormat::Compact)
+	{
+		FLiveLinkAugmentaClusterReader Reader(EventData);
+		FLiveLinkAugmentaClusterQuantization ReceivedQuantization;
+
+		FLiveLinkAugmentaClusterCodec::ReadVersion(Reader);
+		Header.Flags = (EAugmentaFrameBatchFlags)Reader.ReadUInt8();
+
+		if (EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::HasScene)) { FLiveLinkAugmentaClusterCodec::ReadScene(Reader, AugmentaScene); }
+		if (EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::HasVideoOutput)) { FLiveLinkAugmentaClusterCodec::ReadVideoOutput(Reader, AugmentaVideoOutput); }
+
+		FLiveLinkAugmentaClusterCodec::ReadQuantization(Reader, ReceivedQuantization);
+
+		//Objects are read from the chunk of this node when the frame is split per node
+		FLiveLinkAugmentaClusterReader ChunkReader(nullptr, 0);
+		bool bHasChunk = true;
+
+		if (EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::InterestChunks))
+		{
+			bHasChunk = false;
+			const uint32 ChunkCount = Reader.ReadVarUInt();
+
+			for (uint32 i = 0; i < ChunkCount && !Reader.HasError(); i++)
+			{
+				const FString ChunkNodeId = ReadNodeId(Reader);
+				const int32 ChunkSize = (int32)Reader.ReadVarUInt();
+				const uint8* ChunkData = Reader.ReadBytes(ChunkSize);
+
+				//The chunk with an empty node id holds every object, for the nodes without a region
+				if (ChunkData && (ChunkNodeId == LocalNodeId || (ChunkNodeId.IsEmpty() && !bHasChunk)))
+				{
+					ChunkReader = FLiveLinkAugmentaClusterReader(ChunkData, ChunkSize);
+					bHasChunk = true;
+				}
+			}
+		}
+
+		FLiveLinkAugmentaClusterReader& ObjectReader = EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::InterestChunks) ? ChunkReader : Reader;
+
+		Header.EnteredObjectCount = bHasChunk ? ObjectReader.ReadVarUInt() : 0;
+		Header.UpdatedObjectCount = bHasChunk ? ObjectReader.ReadVarUInt() : 0;
+		Header.LeftObjectCount = bHasChunk ? ObjectReader.ReadVarUInt() : 0;
+
+		const bool bDelta = EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::Delta);
+		const bool bKeyframe = EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::Keyframe);
+		int MissedObjectCount = 0;
+
+		auto ReadObjects = [this, &ObjectReader, &ReceivedQuantization, &MissedObjectCount](int32 Count, TArray<FLiveLinkAugmentaObject>& AugmentaObjects, bool bFromTrackedState)
+		{
+			AugmentaObjects.Reset();
+
+			//Each object takes at least two bytes, so a bogus count ends in a read error instead of a huge allocation
+			for (int32 i = 0; i < Count && !ObjectReader.HasError(); i++)
+			{
+				FLiveLinkAugmentaObject AugmentaObject;
+				AugmentaObject.Id = FLiveLinkAugmentaClusterCodec::ReadObjectId(ObjectReader);
+
+				//Delta objects only carry their changed fields, on top of their state on this node or their enter in this frame
+				const FLiveLinkAugmentaObject* TrackedObject = bFromTrackedState ? FindTrackedAugmentaObject(AugmentaObject.Id) : nullptr;
+
+				if (bFromTrackedState && !TrackedObject)
+				{
+					const int32 Id = AugmentaObject.Id;
+					TrackedObject = ReceivedEnteredObjects.FindByPredicate([Id](const FLiveLinkAugmentaObject& EnteredObject) { return EnteredObject.Id == Id; });
+				}
+				if (TrackedObject)
+				{
+					AugmentaObject = *TrackedObject;
+				}
+
+				FLiveLinkAugmentaClusterCodec::ReadObjectFields(ObjectReader, AugmentaObject, ReceivedQuantization);
+
+				//Objects whose enter was missed are ignored until the next keyframe
+				if (bFromTrackedState && !TrackedObject)
+				{
+					MissedObjectCount++;
+					continue;
+				}
+
+				AugmentaObjects.Add(AugmentaObject);
+			}
+		};
+
+		ReadObjects(Header.EnteredObjectCount, ReceivedEnteredObjects, false);
+		//Keyframes send the updated objects with all their fields, so that nodes out of sync can enter them
+		ReadObjects(Header.UpdatedObjectCount, ReceivedUpdatedObjects, bDelta && !bKeyframe);
+		ReadObjects(Header.LeftObjectCount, ReceivedLeftObjects, bDelta);
+
+		ReceivedKeyframeObjects.Reset();
+
+		if (bKeyframe)
+		{
+			ReadObjects(Reader.ReadVarUInt(), ReceivedKeyframeObjects, false);
+		}
+
+		bIsValid = !Reader.HasError() && Reader.IsAtEnd() && !ChunkReader.HasError() && ChunkReader.IsAtEnd();
+
+		if (bIsValid && MissedObjectCount > 0)
+		{
+			UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("Augmenta Cluster Manager: Ignored %d delta objects unknown to this node until the next keyframe."), MissedObjectCount);
+		}
+	}
+	else
+	{
+		const uint8* Cursor = EventData.GetData();
+		const uint8* End = Cursor + EventData.Num();
+
+		ReceivedKeyframeObjects.Reset();
+
+		bIsValid = ReadBinary(Cursor, End, Header)
+			&& (!EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::HasScene) || ReadBinary(Cursor, End, AugmentaScene))
+			&& (!EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::HasVideoOutput) || ReadBinary(Cursor, End, AugmentaVideoOutput))
+			&& ReadBinaryObjects(Cursor, End, Header.EnteredObjectCount, ReceivedEnteredObjects)
+			&& ReadBinaryObjects(Cursor, End, Header.UpdatedObjectCount, ReceivedUpdatedObjects)
+			&& ReadBinaryObjects(Cursor, End, Header.LeftObjectCount, ReceivedLeftObjects);
+	}
+
+	if (!bIsValid)
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Received a malformed Augmenta frame cluster event of %d bytes."), EventData.Num());
+		return;
+	}
+
+	if (EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::Keyframe))
+	{
+		ReceivedKeyframeIds.Reset();
+
+		for (const FLiveLinkAugmentaObject& AugmentaObject : ReceivedEnteredObjects) { ReceivedKeyframeIds.Add(AugmentaObject.Id); }
+
+		//Updated objects of the keyframe unknown to this node entered while it was out of sync, unless they entered in this frame
+		for (int32 i = ReceivedUpdatedObjects.Num() - 1; i >= 0; i--)
+		{
+			if (!FindTrackedAugmentaObject(ReceivedUpdatedObjects[i].Id) && !ReceivedKeyframeIds.Contains(ReceivedUpdatedObjects[i].Id))
+			{
+				ReceivedEnteredObjects.Add(ReceivedUpdatedObjects[i]);
+				ReceivedUpdatedObjects.RemoveAt(i);
+			}
+		}
+
+		for (const FLiveLinkAugmentaObject& AugmentaObject : ReceivedUpdatedObjects) { ReceivedKeyframeIds.Add(AugmentaObject.Id); }
+		for (const FLiveLinkAugmentaObject& AugmentaObject : ReceivedLeftObjects) { ReceivedKeyframeIds.Add(AugmentaObject.Id); }
+		for (const FLiveLinkAugmentaObject& AugmentaObject : ReceivedKeyframeObjects) { ReceivedKeyframeIds.Add(AugmentaObject.Id); }
+
+		//Objects absent from the keyframe left while this node was out of sync
+		for (const TPair<int, FLiveLinkAugmentaObject>& TrackedObject : GetTrackedAugmentaObjects())
+		{
+			if (!ReceivedKeyframeIds.Contains(TrackedObject.Key))
+			{
+				ReceivedLeftObjects.Add(TrackedObject.Value);
+			}
+		}
+
+		//Objects of the keyframe unknown to this node entered while it was out of sync, the others are refreshed silently
+		for (const FLiveLinkAugmentaObject& AugmentaObject : ReceivedKeyframeObjects)
+		{
+			if (FindTrackedAugmentaObject(AugmentaObject.Id))
+			{
+				TrackAugmentaObject(AugmentaObject);
+			}
+			else
+			{
+				ReceivedEnteredObjects.Add(AugmentaObject);
+			}
+		}
+	}
+
+	BroadcastReceivedFrame(EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::HasScene) ? &AugmentaScene : nullptr,
+		EnumHasAnyFlags(Header.Flags, EAugmentaFrameBatchFlags::HasVideoOutput) ? &AugmentaVideoOutput : nullptr);
+}
+
+void ALiveLinkAugmentaClusterManager::ReceiveSceneUpdated(const FLiveLinkAugmentaScene& AugmentaScene)
+{
+	if (!bIsBatchingReceivedEvents)
+	{
+		BroadcastSceneUpdated(AugmentaScene);
+		return;
+	}
+
+	ReceivedScene = AugmentaScene;
+	bHasReceivedScene = true;
+}
+
+void ALiveLinkAugmentaClusterManager::ReceiveVideoOutputUpdated(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput)
+{
+	if (!bIsBatchingReceivedEvents)
+	{
+		BroadcastVideoOutputUpdated(AugmentaVideoOutput);
+		return;
+	}
+
+	ReceivedVideoOutput = AugmentaVideoOutput;
+	bHasReceivedVideoOutput = true;
+}
+
+void ALiveLinkAugmentaClusterManager::ReceiveObjectEvent(int EventType, const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	if (bIsBatchingReceivedEvents)
+	{
+		ReceivedEvents.Add(AugmentaObject.Id, EventType, AugmentaObject);
+		return;
+	}
+
+	switch (EventType)
+	{
+	case 2: //Object entered
+		TrackAugmentaObject(AugmentaObject);
+		BroadcastObjectEntered(AugmentaObject);
+		break;
+
+	case 3: //Object updated
+		TrackAugmentaObject(AugmentaObject);
+		BroadcastObjectUpdated(AugmentaObject);
+		break;
+
+	case 4: //Object left
+		UntrackAugmentaObject(AugmentaObject.Id);
+		BroadcastObjectLeft(AugmentaObject);
+		break;
+
+	default:
+		break;
+	}
 }
 
+void ALiveLinkAugmentaClusterManager::FlushReceivedEvents()
+{
+	if (!bHasReceivedScene && !bHasReceivedVideoOutput && ReceivedEvents.Num() == 0)
+	{
+		return;
+	}
+
+	SplitCoalescedEvents(ReceivedEvents, ReceivedEnteredObjects, ReceivedUpdatedObjects, ReceivedLeftObjects, DeferredReceivedEvents);
+	ReceivedEvents.Reset();
 
+	for (const FAugmentaCoalescedEvent& DeferredEvent : DeferredReceivedEvents)
+	{
+		ReceivedEvents.Add(DeferredEvent);
+	}
+
+	const bool bSceneUpdated = bHasReceivedScene;
+	const bool bVideoOutputUpdated = bHasReceivedVideoOutput;
+	bHasReceivedScene = false;
+	bHasReceivedVideoOutput = false;
+
+	BroadcastReceivedFrame(bSceneUpdated ? &ReceivedScene : nullptr, bVideoOutputUpdated ? &ReceivedVideoOutput : nullptr);
+}
 
+void ALiveLinkAugmentaClusterManager::BroadcastReceivedFrame(const FLiveLinkAugmentaScene* AugmentaScene, const FLiveLinkAugmentaVideoOutput* AugmentaVideoOutput)
+{
+	if (AugmentaScene) { BroadcastSceneUpdated(*AugmentaScene); }
+	if (AugmentaVideoOutput) { BroadcastVideoOutputUpdated(*AugmentaVideoOutput); }
+
+	for (const FLiveLinkAugmentaObject& AugmentaObject : ReceivedEnteredObjects)
+	{
+		TrackAugmentaObject(AugmentaObject);
+		BroadcastObjectEntered(AugmentaObject);
+	}
+
+	for (const FLiveLinkAugmentaObject& AugmentaObject : ReceivedUpdatedObjects)
+	{
+		TrackAugmentaObject(AugmentaObject);
+		BroadcastObjectUpdated(AugmentaObject);
+	}
+
+	for (const FLiveLinkAugmentaObject& AugmentaObject : ReceivedLeftObjects)
+	{
+		UntrackAugmentaObject(AugmentaObject.Id);
+		BroadcastObjectLeft(AugmentaObject);
+	}
+
+	if (ReceivedEnteredObjects.Num() > 0 || ReceivedUpdatedObjects.Num() > 0 || ReceivedLeftObjects.Num() > 0)
+	{
+		BroadcastFrame(ReceivedEnteredObjects, ReceivedUpdatedObjects, ReceivedLeftObjects);
+	}
+}
+
+void ALiveLinkAugmentaClusterManager::SerializeAugmentaSnapshot(TArray<uint8>& OutSnapshotData)
+{
+	const EAugmentaClusterObjectFields Fields = FLiveLinkAugmentaClusterCodec::GetObjectFields(bSendReducedObjectData);
+	const TMap<int, FLiveLinkAugmentaObject>& TrackedObjects = AugmentaEventDispatcher->GetTrackedAugmentaObjects();
+
+	OutSnapshotData.Reset();
+	FLiveLinkAugmentaClusterWriter Writer(OutSnapshotData);
+
+	//A revision of 0 means the scene or video output was never received
+	FLiveLinkAugmentaClusterCodec::WriteVersion(Writer);
+	Writer.WriteVarUInt(SourceDestroyedRevision);
+	Writer.WriteVarUInt(SceneRevision);
+	if (SceneRevision > 0) { FLiveLinkAugmentaClusterCodec::WriteScene(Writer, SnapshotScene); }
+	Writer.WriteVarUInt(VideoOutputRevision);
+	if (VideoOutputRevision > 0) { FLiveLinkAugmentaClusterCodec::WriteVideoOutput(Writer, SnapshotVideoOutput); }
+
+	FLiveLinkAugmentaClusterCodec::WriteQuantization(Writer, Quantization);
+	Writer.WriteVarUInt(TrackedObjects.Num());
+
+	for (const TPair<int, FLiveLinkAugmentaObject>& TrackedObject : TrackedObjects)
+	{
+		FLiveLinkAugmentaClusterCodec::WriteObject(Writer, TrackedObject.Value, Fields, Quantization);
+	}
+}
+
+void ALiveLinkAugmentaClusterManager::ApplyAugmentaSnapshot(const FString& Snapshot)
+{
+	if (!FBase64::Decode(Snapshot, SnapshotData))
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Received an invalid Augmenta snapshot."));
+		return;
+	}
+
+	FLiveLinkAugmentaClusterReader Reader(SnapshotData);
+	FLiveLinkAugmentaClusterQuantization ReceivedQuantization;
+	FLiveLinkAugmentaScene AugmentaScene;
+	FLiveLinkAugmentaVideoOutput AugmentaVideoOutput;
+
+	//Decode the whole snapshot before applying it so that a truncated snapshot is ignored entirely
+	FLiveLinkAugmentaClusterCodec::ReadVersion(Reader);
+	const uint32 ReceivedSourceDestroyedRevision = Reader.ReadVarUInt();
+	const uint32 ReceivedSceneRevision = Reader.ReadVarUInt();
+	if (ReceivedSceneRevision > 0) { FLiveLinkAugmentaClusterCodec::ReadScene(Reader, AugmentaScene); }
+	const uint32 ReceivedVideoOutputRevision = Reader.ReadVarUInt();
+	if (ReceivedVideoOutputRevision > 0) { FLiveLinkAugmentaClusterCodec::ReadVideoOutput(Reader, AugmentaVideoOutput); }
+
+	FLiveLinkAugmentaClusterCodec::ReadQuantization(Reader, ReceivedQuantization);
+	const uint32 ObjectCount = Reader.ReadVarUInt();
+
+	//Each object takes at least two bytes, so a bogus count ends in a read error instead of a huge allocation
+	ReceivedSnapshotObjects.Reset();
+
+	for (uint32 i = 0; i < ObjectCount && !Reader.HasError(); i++)
+	{
+		FLiveLinkAugmentaObject& AugmentaObject = ReceivedSnapshotObjects.AddDefaulted_GetRef();
+		FLiveLinkAugmentaClusterCodec::ReadObject(Reader, AugmentaObject, ReceivedQuantization);
+	}
+
+	if (Reader.HasError() || !Reader.IsAtEnd())
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("Augmenta Cluster Manager: Received a malformed Augmenta snapshot of %d bytes."), SnapshotData.Num());
+		return;
+	}
+
+	//The source was destroyed since the last snapshot, every object of this one enters again
+	if (ReceivedSourceDestroyedRevision != AppliedSourceDestroyedRevision)
+	{
+		AppliedSourceDestroyedRevision = ReceivedSourceDestroyedRevision;
+		BroadcastSourceDestroyed();
+	}
+
+	const bool bSceneUpdated = ReceivedSceneRevision > 0 && ReceivedSceneRevision != AppliedSceneRevision;
+	const bool bVideoOutputUpdated = ReceivedVideoOutputRevision > 0 && ReceivedVideoOutputRevision != AppliedVideoOutputRevision;
+	AppliedSceneRevision = ReceivedSceneRevision;
+	AppliedVideoOutputRevision = ReceivedVideoOutputRevision;
+
+	DiffReceivedObjects(ReceivedSnapshotObjects, ReceivedQuantization);
+
+	BroadcastReceivedFrame(bSceneUpdated ? &AugmentaScene : nullptr, bVideoOutputUpdated ? &AugmentaVideoOutput : nullptr);
+}
+
+void ALiveLinkAugmentaClusterManager::DiffReceivedObjects(const TArray<FLiveLinkAugmentaObject>& AugmentaObjects, const FLiveLinkAugmentaClusterQuantization& ObjectQuantization)
+{
+	ReceivedEnteredObjects.Reset();
+	ReceivedUpdatedObjects.Reset();
+	ReceivedLeftObjects.Reset();
+	ReceivedKeyframeIds.Reset();
+
+	for (const FLiveLinkAugmentaObject& AugmentaObject : AugmentaObjects)
+	{
+		ReceivedKeyframeIds.Add(AugmentaObject.Id);
+
+		const FLiveLinkAugmentaObject* TrackedObject = FindTrackedAugmentaObject(AugmentaObject.Id);
+
+		if (!TrackedObject)
+		{
+			ReceivedEnteredObjects.Add(AugmentaObject);
+		}
+		else if (FLiveLinkAugmentaClusterCodec::GetChangedFields(*TrackedObject, AugmentaObject, ObjectQuantization) != EAugmentaClusterObjectFields::None)
+		{
+			ReceivedUpdatedObjects.Add(AugmentaObject);
+		}
+	}
+
+	for (const TPair<int, FLiveLinkAugmentaObject>& TrackedObject : GetTrackedAugmentaObjects())
+	{
+		if (!ReceivedKeyframeIds.Contains(TrackedObject.Key))
+		{
+			ReceivedLeftObjects.Add(TrackedObject.Value);
+		}
+	}
+}
@@ -0,0 +1,90 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaClusterSource.h"
+
+#include "LiveLinkAugmentaEventDispatcher.h"
+
+#define LOCTEXT_NAMESPACE "LiveLinkAugmentaClusterSource"
+
+FLiveLinkAugmentaClusterSource::FLiveLinkAugmentaClusterSource(FName InSceneName)
+: SceneName(InSceneName)
+{
+}
+
+void FLiveLinkAugmentaClusterSource::ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid)
+{
+	SubjectPusher.Initialize(InClient, InSourceGuid, SceneName);
+}
+
+bool FLiveLinkAugmentaClusterSource::RequestSourceShutdown()
+{
+	bIsShutdown = true;
+
+	//The client removes the subjects of the source itself
+	SubjectPusher.Initialize(nullptr, FGuid(), SceneName);
+
+	return true;
+}
+
+FText FLiveLinkAugmentaClusterSource::GetSourceType() const
+{
+	return LOCTEXT("SourceType_AugmentaCluster", "Augmenta Cluster");
+}
+
+FText FLiveLinkAugmentaClusterSource::GetSourceMachineName() const
+{
+	return FText::FromName(SceneName);
+}
+
+FText FLiveLinkAugmentaClusterSource::GetSourceStatus() const
+{
+	return bIsShutdown ? LOCTEXT("SourceStatus_Shutdown", "Shut down") : LOCTEXT("SourceStatus_Replicated", "Replicated");
+}
+
+void FLiveLinkAugmentaClusterSource::Attach(ALiveLinkAugmentaEventDispatcher* EventDispatcher)
+{
+	//The native object events ignore bBroadcastPerObjectEvents, so every replication mode is covered
+	EventDispatcher->OnAugmentaSceneUpdatedNative.AddSP(this, &FLiveLinkAugmentaClusterSource::OnAugmentaSceneUpdated);
+	EventDispatcher->OnAugmentaVideoOutputUpdatedNative.AddSP(this, &FLiveLinkAugmentaClusterSource::OnAugmentaVideoOutputUpdated);
+	EventDispatcher->OnAugmentaObjectEnteredNative.AddSP(this, &FLiveLinkAugmentaClusterSource::OnAugmentaObjectUpdated);
+	EventDispatcher->OnAugmentaObjectUpdatedNative.AddSP(this, &FLiveLinkAugmentaClusterSource::OnAugmentaObjectUpdated);
+	EventDispatcher->OnAugmentaObjectLeftNative.AddSP(this, &FLiveLinkAugmentaClusterSource::OnAugmentaObjectLeft);
+	EventDispatcher->OnAugmentaSourceDestroyedNative.AddSP(this, &FLiveLinkAugmentaClusterSource::OnAugmentaSourceDestroyed);
+}
+
+void FLiveLinkAugmentaClusterSource::Detach(ALiveLinkAugmentaEventDispatcher* EventDispatcher)
+{
+	EventDispatcher->OnAugmentaSceneUpdatedNative.RemoveAll(this);
+	EventDispatcher->OnAugmentaVideoOutputUpdatedNative.RemoveAll(this);
+	EventDispatcher->OnAugmentaObjectEnteredNative.RemoveAll(this);
+	EventDispatcher->OnAugmentaObjectUpdatedNative.RemoveAll(this);
+	EventDispatcher->OnAugmentaObjectLeftNative.RemoveAll(this);
+	EventDispatcher->OnAugmentaSourceDestroyedNative.RemoveAll(this);
+}
+
+void FLiveLinkAugmentaClusterSource::OnAugmentaSceneUpdated(const FLiveLinkAugmentaScene& AugmentaScene)
+{
+	SubjectPusher.PushScene(AugmentaScene);
+}
+
+void FLiveLinkAugmentaClusterSource::OnAugmentaVideoOutputUpdated(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput)
+{
+	SubjectPusher.PushVideoOutput(AugmentaVideoOutput);
+}
+
+void FLiveLinkAugmentaClusterSource::OnAugmentaObjectUpdated(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	SubjectPusher.PushObject(AugmentaObject);
+}
+
+void FLiveLinkAugmentaClusterSource::OnAugmentaObjectLeft(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	SubjectPusher.RemoveObject(AugmentaObject);
+}
+
+void FLiveLinkAugmentaClusterSource::OnAugmentaSourceDestroyed()
+{
+	SubjectPusher.RemoveObjects();
+}
+
+#undef LOCTEXT_NAMESPACE
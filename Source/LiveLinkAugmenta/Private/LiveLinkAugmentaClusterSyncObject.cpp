@@ -0,0 +1,57 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaClusterSyncObject.h"
+
+void FLiveLinkAugmentaClusterSyncObject::SetSnapshot(const FString& InSnapshot)
+{
+	FScopeLock Lock(&SnapshotLock);
+
+	Snapshot = InSnapshot;
+	bIsDirty = true;
+}
+
+bool FLiveLinkAugmentaClusterSyncObject::ConsumeSnapshot(FString& OutSnapshot)
+{
+	FScopeLock Lock(&SnapshotLock);
+
+	if (!bIsReceived)
+	{
+		return false;
+	}
+
+	OutSnapshot = MoveTemp(Snapshot);
+	bIsReceived = false;
+
+	return true;
+}
+
+bool FLiveLinkAugmentaClusterSyncObject::IsDirty() const
+{
+	FScopeLock Lock(&SnapshotLock);
+
+	return bIsDirty;
+}
+
+void FLiveLinkAugmentaClusterSyncObject::ClearDirty()
+{
+	FScopeLock Lock(&SnapshotLock);
+
+	bIsDirty = false;
+}
+
+FString FLiveLinkAugmentaClusterSyncObject::SerializeToString() const
+{
+	FScopeLock Lock(&SnapshotLock);
+
+	return Snapshot;
+}
+
+bool FLiveLinkAugmentaClusterSyncObject::DeserializeFromString(const FString& Data)
+{
+	FScopeLock Lock(&SnapshotLock);
+
+	Snapshot = Data;
+	bIsReceived = true;
+
+	return true;
+}
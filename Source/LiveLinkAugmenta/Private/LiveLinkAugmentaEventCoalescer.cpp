@@ -0,0 +1,63 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaEventCoalescer.h"
+
+void FLiveLinkAugmentaEventCoalescer::Add(int ObjectId, int EventType, const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	EAugmentaLifecycleFlags Flag;
+
+	switch (EventType)
+	{
+	case 2: //Object entered
+		Flag = EAugmentaLifecycleFlags::Entered;
+		break;
+
+	case 4: //Object left
+		Flag = EAugmentaLifecycleFlags::Left;
+		break;
+
+	default: //Scene, video output or object updated
+		Flag = EAugmentaLifecycleFlags::Updated;
+		break;
+	}
+
+	int32& EventIndex = IdToEventIndex.FindOrAdd(ObjectId, INDEX_NONE);
+
+	if (EventIndex != INDEX_NONE)
+	{
+		FAugmentaCoalescedEvent& Event = Events[EventIndex];
+
+		if (!Event.HasLeft())
+		{
+			Event.Flags |= Flag;
+			Event.AugmentaObject = AugmentaObject;
+			return;
+		}
+
+		//Nothing can update an object after it left
+		if (Flag != EAugmentaLifecycleFlags::Entered)
+		{
+			return;
+		}
+
+		//The object came back, start a new lifecycle after the previous one
+	}
+
+	EventIndex = Events.Num();
+
+	FAugmentaCoalescedEvent& Event = Events.AddDefaulted_GetRef();
+	Event.ObjectId = ObjectId;
+	Event.Flags = Flag;
+	Event.AugmentaObject = AugmentaObject;
+}
+
+void FLiveLinkAugmentaEventCoalescer::Add(const FAugmentaCoalescedEvent& Event)
+{
+	IdToEventIndex.Add(Event.ObjectId, Events.Add(Event));
+}
+
+void FLiveLinkAugmentaEventCoalescer::Reset()
+{
+	Events.Reset();
+	IdToEventIndex.Reset();
+}
@@ -3,6 +3,473 @@
 
 #include "LiveLinkAugmentaEventDispatcher.h"
 
+#include "Engine/World.h"
+#include "TimerManager.h"
+
 ALiveLinkAugmentaEventDispatcher::ALiveLinkAugmentaEventDispatcher()
 {
 }
+
+void ALiveLinkAugmentaEventDispatcher::BeginPlay()
+{
+	Super::BeginPlay();
+
+	SpatialIndex.SetCellSize(SpatialIndexCellSize);
+}
+
+void ALiveLinkAugmentaEventDispatcher::GetAugmentaObjectsInRadius(FVector Center, float Radius, TArray<FLiveLinkAugmentaObject>& AugmentaObjects) const
+{
+	TArray<int> Ids;
+	SpatialIndex.QueryRadius(FVector2D(Center), Radius, Ids);
+	GetTrackedAugmentaObjectsFromIds(Ids, AugmentaObjects);
+}
+
+void ALiveLinkAugmentaEventDispatcher::GetAugmentaObjectsInRect(FVector Center, FVector2D Size, float Rotation, TArray<FLiveLinkAugmentaObject>& AugmentaObjects) const
+{
+	TArray<int> Ids;
+	SpatialIndex.QueryOrientedRect(FVector2D(Center), Size * .5f, Rotation, Ids);
+	GetTrackedAugmentaObjectsFromIds(Ids, AugmentaObjects);
+}
+
+void ALiveLinkAugmentaEventDispatcher::GetNearestAugmentaObjects(FVector Point, int Count, float MaxDistance, TArray<FLiveLinkAugmentaObject>& AugmentaObjects) const
+{
+	TArray<int> Ids;
+	SpatialIndex.QueryNearest(FVector2D(Point), Count, Ids, MaxDistance > 0 ? MaxDistance : UE_BIG_NUMBER);
+	GetTrackedAugmentaObjectsFromIds(Ids, AugmentaObjects);
+}
+
+bool ALiveLinkAugmentaEventDispatcher::GetNearestAugmentaObject(FVector Point, float MaxDistance, FLiveLinkAugmentaObject& AugmentaObject) const
+{
+	const int Id = SpatialIndex.FindNearest(FVector2D(Point), MaxDistance > 0 ? MaxDistance : UE_BIG_NUMBER);
+
+	if (const FLiveLinkAugmentaObject* NearestObject = TrackedObjects.Find(Id))
+	{
+		AugmentaObject = *NearestObject;
+		return true;
+	}
+
+	return false;
+}
+
+FDelegateHandle ALiveLinkAugmentaEventDispatcher::SubscribeToAugmentaObject(int Id, FAugmentaObjectSubscriptionNativeEvent::FDelegate&& Delegate)
+{
+	TSharedRef<FAugmentaObjectSubscriptionNativeEvent>* Subscribers = ObjectSubscribers.Find(Id);
+
+	if (!Subscribers)
+	{
+		Subscribers = &ObjectSubscribers.Add(Id, MakeShared<FAugmentaObjectSubscriptionNativeEvent>());
+	}
+
+	return (*Subscribers)->Add(MoveTemp(Delegate));
+}
+
+void ALiveLinkAugmentaEventDispatcher::UnsubscribeFromAugmentaObject(int Id, FDelegateHandle Handle)
+{
+	if (TSharedRef<FAugmentaObjectSubscriptionNativeEvent>* Subscribers = ObjectSubscribers.Find(Id))
+	{
+		(*Subscribers)->Remove(Handle);
+
+		if (!(*Subscribers)->IsBound())
+		{
+			ObjectSubscribers.Remove(Id);
+		}
+	}
+}
+
+int ALiveLinkAugmentaEventDispatcher::AddAugmentaSubscription(const FLiveLinkAugmentaSubscriptionFilter& Filter, FAugmentaFilteredFrameEvent Event)
+{
+	FFilteredSubscription Subscription;
+	Subscription.Filter = Filter;
+	Subscription.DynamicDelegate = Event;
+
+	return AddFilteredSubscription(MoveTemp(Subscription));
+}
+
+int ALiveLinkAugmentaEventDispatcher::AddAugmentaSubscriptionNative(const FLiveLinkAugmentaSubscriptionFilter& Filter, FAugmentaFrameNativeEvent::FDelegate&& Delegate)
+{
+	FFilteredSubscription Subscription;
+	Subscription.Filter = Filter;
+	Subscription.NativeDelegate = MoveTemp(Delegate);
+
+	return AddFilteredSubscription(MoveTemp(Subscription));
+}
+
+bool ALiveLinkAugmentaEventDispatcher::SetAugmentaSubscriptionFilter(int Handle, const FLiveLinkAugmentaSubscriptionFilter& Filter)
+{
+	FFilteredSubscription* Subscription = FindFilteredSubscription(Handle);
+
+	if (!Subscription)
+	{
+		return false;
+	}
+
+	Subscription->Filter = Filter;
+	Subscription->PendingUpdates.Reset();
+	Subscription->ObjectsInZone.Reset();
+
+	return true;
+}
+
+bool ALiveLinkAugmentaEventDispatcher::RemoveAugmentaSubscription(int Handle)
+{
+	FFilteredSubscription* Subscription = FindFilteredSubscription(Handle);
+
+	if (!Subscription)
+	{
+		return false;
+	}
+
+	//Only mark it while dispatching, it is removed once the dispatch is done
+	Subscription->Handle = 0;
+
+	if (!bDispatchingFilteredSubscriptions)
+	{
+		FilteredSubscriptions.RemoveAll([](const FFilteredSubscription& Other) { return Other.Handle == 0; });
+		AddedFilteredSubscriptions.RemoveAll([](const FFilteredSubscription& Other) { return Other.Handle == 0; });
+	}
+
+	return true;
+}
+
+void ALiveLinkAugmentaEventDispatcher::BroadcastSceneUpdated(const FLiveLinkAugmentaScene& AugmentaScene)
+{
+	OnAugmentaSceneUpdatedNative.Broadcast(AugmentaScene);
+	OnAugmentaSceneUpdated.Broadcast(AugmentaScene);
+}
+
+void ALiveLinkAugmentaEventDispatcher::BroadcastVideoOutputUpdated(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput)
+{
+	OnAugmentaVideoOutputUpdatedNative.Broadcast(AugmentaVideoOutput);
+	OnAugmentaVideoOutputUpdated.Broadcast(AugmentaVideoOutput);
+}
+
+void ALiveLinkAugmentaEventDispatcher::BroadcastObjectEntered(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	OnAugmentaObjectEnteredNative.Broadcast(AugmentaObject);
+	NotifyObjectSubscribers(AugmentaObject, EAugmentaLifecycleFlags::Entered);
+
+	if (bBroadcastPerObjectEvents)
+	{
+		OnAugmentaObjectEntered.Broadcast(AugmentaObject);
+	}
+}
+
+void ALiveLinkAugmentaEventDispatcher::BroadcastObjectUpdated(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	OnAugmentaObjectUpdatedNative.Broadcast(AugmentaObject);
+	NotifyObjectSubscribers(AugmentaObject, EAugmentaLifecycleFlags::Updated);
+
+	if (bBroadcastPerObjectEvents)
+	{
+		OnAugmentaObjectUpdated.Broadcast(AugmentaObject);
+	}
+}
+
+void ALiveLinkAugmentaEventDispatcher::BroadcastObjectLeft(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	OnAugmentaObjectLeftNative.Broadcast(AugmentaObject);
+	NotifyObjectSubscribers(AugmentaObject, EAugmentaLifecycleFlags::Left);
+
+	if (bBroadcastPerObjectEvents)
+	{
+		OnAugmentaObjectLeft.Broadcast(AugmentaObject);
+	}
+}
+
+void ALiveLinkAugmentaEventDispatcher::BroadcastFrame(const TArray<FLiveLinkAugmentaObject>& EnteredObjects, const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects)
+{
+	OnAugmentaFrameNative.Broadcast(EnteredObjects, UpdatedObjects, LeftObjects);
+	OnAugmentaFrame.Broadcast(EnteredObjects, UpdatedObjects, LeftObjects);
+
+	DispatchFilteredSubscriptions(EnteredObjects, UpdatedObjects, LeftObjects);
+}
+
+void ALiveLinkAugmentaEventDispatcher::BroadcastZoneEvent(const FLiveLinkAugmentaZoneEvent& ZoneEvent)
+{
+	OnAugmentaZoneEventNative.Broadcast(ZoneEvent);
+
+	switch (ZoneEvent.Type)
+	{
+	case EAugmentaZoneEventType::Enter:
+		OnAugmentaZoneEnter.Broadcast(ZoneEvent.ZoneName, ZoneEvent.ObjectId);
+		break;
+
+	case EAugmentaZoneEventType::Leave:
+		OnAugmentaZoneLeave.Broadcast(ZoneEvent.ZoneName, ZoneEvent.ObjectId);
+		break;
+
+	case EAugmentaZoneEventType::OccupancyChanged:
+		OnAugmentaZoneOccupancyChanged.Broadcast(ZoneEvent.ZoneName, ZoneEvent.Occupancy);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void ALiveLinkAugmentaEventDispatcher::BroadcastSourceDestroyed()
+{
+	//Subscribers of an object are told it left with the source
+	TArray<FLiveLinkAugmentaObject> SubscribedObjects;
+
+	for (const TPair<int, FLiveLinkAugmentaObject>& TrackedObject : TrackedObjects)
+	{
+		if (ObjectSubscribers.Contains(TrackedObject.Key))
+		{
+			SubscribedObjects.Add(TrackedObject.Value);
+		}
+	}
+
+	ResetTrackedAugmentaObjects();
+
+	for (const FLiveLinkAugmentaObject& AugmentaObject : SubscribedObjects)
+	{
+		NotifyObjectSubscribers(AugmentaObject, EAugmentaLifecycleFlags::Left);
+	}
+
+	//The objects of the destroyed source are gone, nothing is left to send
+	for (FFilteredSubscription& Subscription : FilteredSubscriptions)
+	{
+		Subscription.PendingUpdates.Reset();
+		Subscription.ObjectsInZone.Reset();
+	}
+
+	OnAugmentaSourceDestroyedNative.Broadcast();
+	OnAugmentaSourceDestroyed.Broadcast();
+}
+
+void ALiveLinkAugmentaEventDispatcher::TrackAugmentaObject(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	TrackedObjects.Add(AugmentaObject.Id, AugmentaObject);
+	SpatialIndex.Update(AugmentaObject.Id, FVector2D(AugmentaObject.Position));
+}
+
+void ALiveLinkAugmentaEventDispatcher::UntrackAugmentaObject(int Id)
+{
+	TrackedObjects.Remove(Id);
+	SpatialIndex.Remove(Id);
+}
+
+void ALiveLinkAugmentaEventDispatcher::ResetTrackedAugmentaObjects()
+{
+	TrackedObjects.Reset();
+	SpatialIndex.Reset();
+}
+
+void ALiveLinkAugmentaEventDispatcher::GetTrackedAugmentaObjectsFromIds(const TArray<int>& Ids, TArray<FLiveLinkAugmentaObject>& AugmentaObjects) const
+{
+	AugmentaObjects.Reset(Ids.Num());
+
+	for (const int Id : Ids)
+	{
+		AugmentaObjects.Add(TrackedObjects.FindChecked(Id));
+	}
+}
+
+void ALiveLinkAugmentaEventDispatcher::NotifyObjectSubscribers(const FLiveLinkAugmentaObject& AugmentaObject, EAugmentaLifecycleFlags Event)
+{
+	if (ObjectSubscribers.IsEmpty())
+	{
+		return;
+	}
+
+	if (const TSharedRef<FAugmentaObjectSubscriptionNativeEvent>* Subscribers = ObjectSubscribers.Find(AugmentaObject.Id))
+	{
+		//Keep the subscribers alive even if the map changes during the broadcast
+		const TSharedRef<FAugmentaObjectSubscriptionNativeEvent> SubscribersRef = *Subscribers;
+		SubscribersRef->Broadcast(AugmentaObject, Event);
+	}
+}
+
+int ALiveLinkAugmentaEventDispatcher::AddFilteredSubscription(FFilteredSubscription&& Subscription)
+{
+	Subscription.Handle = NextSubscriptionHandle++;
+
+	const int Handle = Subscription.Handle;
+
+	//Adding to FilteredSubscriptions while dispatching could move the subscription being fired
+	if (bDispatchingFilteredSubscriptions)
+	{
+		AddedFilteredSubscriptions.Add(MoveTemp(Subscription));
+	}
+	else
+	{
+		FilteredSubscriptions.Add(MoveTemp(Subscription));
+	}
+
+	return Handle;
+}
+
+ALiveLinkAugmentaEventDispatcher::FFilteredSubscription* ALiveLinkAugmentaEventDispatcher::FindFilteredSubscription(int Handle)
+{
+	if (Handle <= 0)
+	{
+		return nullptr;
+	}
+
+	auto MatchesHandle = [Handle](const FFilteredSubscription& Subscription) { return Subscription.Handle == Handle; };
+
+	if (FFilteredSubscription* Subscription = FilteredSubscriptions.FindByPredicate(MatchesHandle))
+	{
+		return Subscription;
+	}
+
+	return AddedFilteredSubscriptions.FindByPredicate(MatchesHandle);
+}
+
+void ALiveLinkAugmentaEventDispatcher::DispatchFilteredSubscriptions(const TArray<FLiveLinkAugmentaObject>& EnteredObjects, const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects)
+{
+	if (FilteredSubscriptions.Num() == 0)
+	{
+		return;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	bDispatchingFilteredSubscriptions = true;
+
+	for (FFilteredSubscription& Subscription : FilteredSubscriptions)
+	{
+		if (Subscription.Handle == 0)
+		{
+			continue;
+		}
+
+		const FLiveLinkAugmentaSubscriptionFilter& Filter = Subscription.Filter;
+
+		FilteredEnteredObjects.Reset();
+		FilteredUpdatedObjects.Reset();
+		FilteredLeftObjects.Reset();
+
+		for (const FLiveLinkAugmentaObject& AugmentaObject : EnteredObjects)
+		{
+			if (!Filter.AcceptsObject(AugmentaObject))
+			{
+				continue;
+			}
+
+			if (Filter.bFilterByZone)
+			{
+				Subscription.ObjectsInZone.Add(AugmentaObject.Id);
+			}
+
+			if (Filter.AcceptsEvent(EAugmentaLifecycleFlags::Entered))
+			{
+				FilteredEnteredObjects.Add(AugmentaObject);
+			}
+		}
+
+		const bool bLimitUpdateRate = Filter.MaxUpdateRate > 0;
+
+		for (const FLiveLinkAugmentaObject& AugmentaObject : UpdatedObjects)
+		{
+			const bool bIsAccepted = Filter.AcceptsObject(AugmentaObject);
+
+			//Objects moving into or out of the zone enter or leave it
+			if (Filter.bFilterByZone && bIsAccepted != Subscription.ObjectsInZone.Contains(AugmentaObject.Id))
+			{
+				Subscription.PendingUpdates.Remove(AugmentaObject.Id);
+
+				if (bIsAccepted)
+				{
+					Subscription.ObjectsInZone.Add(AugmentaObject.Id);
+
+					if (Filter.AcceptsEvent(EAugmentaLifecycleFlags::Entered)) { FilteredEnteredObjects.Add(AugmentaObject); }
+				}
+				else
+				{
+					Subscription.ObjectsInZone.Remove(AugmentaObject.Id);
+
+					if (Filter.AcceptsEvent(EAugmentaLifecycleFlags::Left)) { FilteredLeftObjects.Add(AugmentaObject); }
+				}
+
+				continue;
+			}
+
+			if (!bIsAccepted || !Filter.AcceptsEvent(EAugmentaLifecycleFlags::Updated))
+			{
+				continue;
+			}
+
+			if (bLimitUpdateRate)
+			{
+				//Keep the latest state of each object until updates can be sent again
+				Subscription.PendingUpdates.Add(AugmentaObject.Id, AugmentaObject);
+			}
+			else
+			{
+				FilteredUpdatedObjects.Add(AugmentaObject);
+			}
+		}
+
+		for (const FLiveLinkAugmentaObject& AugmentaObject : LeftObjects)
+		{
+			Subscription.PendingUpdates.Remove(AugmentaObject.Id);
+
+			//Objects that left from inside the zone, wherever their last position
+			const bool bWasAccepted = Filter.bFilterByZone ? Subscription.ObjectsInZone.Remove(AugmentaObject.Id) > 0 : true;
+
+			if (bWasAccepted && Filter.AcceptsEvent(EAugmentaLifecycleFlags::Left))
+			{
+				FilteredLeftObjects.Add(AugmentaObject);
+			}
+		}
+
+		if (bLimitUpdateRate && Subscription.PendingUpdates.Num() > 0 && CurrentTime - Subscription.LastUpdateTime >= 1.0 / Filter.MaxUpdateRate)
+		{
+			Subscription.PendingUpdates.GenerateValueArray(FilteredUpdatedObjects);
+			Subscription.PendingUpdates.Reset();
+			Subscription.LastUpdateTime = CurrentTime;
+		}
+
+		if (FilteredEnteredObjects.Num() == 0 && FilteredUpdatedObjects.Num() == 0 && FilteredLeftObjects.Num() == 0)
+		{
+			continue;
+		}
+
+		Subscription.NativeDelegate.ExecuteIfBound(FilteredEnteredObjects, FilteredUpdatedObjects, FilteredLeftObjects);
+		Subscription.DynamicDelegate.ExecuteIfBound(FilteredEnteredObjects, FilteredUpdatedObjects, FilteredLeftObjects);
+	}
+
+	bDispatchingFilteredSubscriptions = false;
+
+	//Apply the changes made by the subscribers
+	FilteredSubscriptions.RemoveAll([](const FFilteredSubscription& Subscription) { return Subscription.Handle == 0; });
+
+	if (AddedFilteredSubscriptions.Num() > 0)
+	{
+		FilteredSubscriptions.Append(MoveTemp(AddedFilteredSubscriptions));
+		AddedFilteredSubscriptions.Reset();
+	}
+
+	//The objects may stop updating, held back updates are then sent when due
+	double NextFlushDelay = -1;
+
+	for (const FFilteredSubscription& Subscription : FilteredSubscriptions)
+	{
+		if (Subscription.PendingUpdates.Num() > 0 && Subscription.Filter.MaxUpdateRate > 0)
+		{
+			const double Delay = Subscription.LastUpdateTime + 1.0 / Subscription.Filter.MaxUpdateRate - CurrentTime;
+			NextFlushDelay = NextFlushDelay < 0 ? Delay : FMath::Min(NextFlushDelay, Delay);
+		}
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (NextFlushDelay >= 0)
+		{
+			World->GetTimerManager().SetTimer(PendingUpdatesTimerHandle, this, &ALiveLinkAugmentaEventDispatcher::FlushPendingUpdates, FMath::Max((float)NextFlushDelay, 0.001f), false);
+		}
+		else
+		{
+			World->GetTimerManager().ClearTimer(PendingUpdatesTimerHandle);
+		}
+	}
+}
+
+void ALiveLinkAugmentaEventDispatcher::FlushPendingUpdates()
+{
+	const TArray<FLiveLinkAugmentaObject> NoObjects;
+
+	DispatchFilteredSubscriptions(NoObjects, NoObjects, NoObjects);
+}
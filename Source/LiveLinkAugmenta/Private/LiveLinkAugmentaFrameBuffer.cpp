@@ -0,0 +1,87 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaFrameBuffer.h"
+
+FLiveLinkAugmentaFrameBuffer::FLiveLinkAugmentaFrameBuffer(int32 InCapacity)
+{
+	Frames.SetNum(FMath::Max(InCapacity, 1));
+}
+
+void FLiveLinkAugmentaFrameBuffer::Push(const FLiveLinkAugmentaScene& AugmentaScene, const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput, uint32 VideoOutputRevision, const TMap<int, FLiveLinkAugmentaObject>& AugmentaObjects)
+{
+	FScopeLock Lock(&FramesLock);
+
+	const int32 Capacity = Frames.Num();
+
+	//The stream restarted, the buffered frames can not be compared with the new ones
+	if (Num > 0 && AugmentaScene.Frame <= Frames[(NextSlot + Capacity - 1) % Capacity].AugmentaScene.Frame)
+	{
+		Num = 0;
+	}
+
+	FLiveLinkAugmentaBufferedFrame& BufferedFrame = Frames[NextSlot];
+	BufferedFrame.AugmentaScene = AugmentaScene;
+	BufferedFrame.AugmentaVideoOutput = AugmentaVideoOutput;
+	BufferedFrame.VideoOutputRevision = VideoOutputRevision;
+
+	BufferedFrame.AugmentaObjects.Reset();
+	for (const TPair<int, FLiveLinkAugmentaObject>& AugmentaObject : AugmentaObjects)
+	{
+		BufferedFrame.AugmentaObjects.Add(AugmentaObject.Value);
+	}
+
+	NextSlot = (NextSlot + 1) % Capacity;
+	Num = FMath::Min(Num + 1, Capacity);
+}
+
+void FLiveLinkAugmentaFrameBuffer::Reset()
+{
+	FScopeLock Lock(&FramesLock);
+
+	Num = 0;
+}
+
+bool FLiveLinkAugmentaFrameBuffer::GetLatestFrameNumber(int32& OutFrame, int32 Age) const
+{
+	FScopeLock Lock(&FramesLock);
+
+	if (Age < 0 || Age >= Num)
+	{
+		return false;
+	}
+
+	OutFrame = Frames[(NextSlot + Frames.Num() - 1 - Age) % Frames.Num()].AugmentaScene.Frame;
+	return true;
+}
+
+ELiveLinkAugmentaFrameLookup FLiveLinkAugmentaFrameBuffer::ReadFrame(int32 Frame, FLiveLinkAugmentaBufferedFrame& OutFrame) const
+{
+	FScopeLock Lock(&FramesLock);
+
+	const int32 Capacity = Frames.Num();
+
+	//Frame numbers only grow between restarts, search from the newest frame
+	for (int32 i = 1; i <= Num; i++)
+	{
+		const FLiveLinkAugmentaBufferedFrame& BufferedFrame = Frames[(NextSlot + Capacity - i) % Capacity];
+
+		if (BufferedFrame.AugmentaScene.Frame == Frame)
+		{
+			OutFrame.AugmentaScene = BufferedFrame.AugmentaScene;
+			OutFrame.AugmentaVideoOutput = BufferedFrame.AugmentaVideoOutput;
+			OutFrame.VideoOutputRevision = BufferedFrame.VideoOutputRevision;
+			OutFrame.AugmentaObjects.Reset();
+			OutFrame.AugmentaObjects.Append(BufferedFrame.AugmentaObjects);
+
+			return ELiveLinkAugmentaFrameLookup::Found;
+		}
+
+		if (BufferedFrame.AugmentaScene.Frame < Frame)
+		{
+			//Frames older than the requested one are buffered but not this one, it was lost
+			return i == 1 ? ELiveLinkAugmentaFrameLookup::Pending : ELiveLinkAugmentaFrameLookup::Missed;
+		}
+	}
+
+	return Num == 0 ? ELiveLinkAugmentaFrameLookup::Pending : ELiveLinkAugmentaFrameLookup::Missed;
+}
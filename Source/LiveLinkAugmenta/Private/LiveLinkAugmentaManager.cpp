@@ -2,14 +2,10 @@
 
 #include "LiveLinkAugmentaManager.h"
 
-#include "LiveLinkClient.h"
 #include "LiveLinkPreset.h"
 
 #include "LiveLinkAugmentaSource.h"
-
-#include "Engine/World.h"
-#include "TimerManager.h"
-#include "Features/IModularFeatures.h"
+#include "LiveLinkAugmentaSourceRegistry.h"
 
 
 // Sets default values
@@ -20,7 +16,7 @@ ALiveLinkAugmentaManager::ALiveLinkAugmentaManager()
 
 	SceneName = "AugmentaMain";
 	bIsConnected = false;
-	SourceSearchDelay = 2.0f;
+	LiveLinkAugmentaSource = nullptr;
 }
 
 // Called when the game starts or when spawned
@@ -28,9 +24,6 @@ void ALiveLinkAugmentaManager::BeginPlay()
 {
 	Super::BeginPlay();
 
-	//Create Event data queue
-	AugmentaEventDataQueue = NewObject<UAugmentaEventDataQueue>(this, TEXT("Augmenta Event Data Queue"));
-
 	//Apply Live Link preset
 	if (IsValid(LiveLinkPreset)) {
 		LiveLinkPreset->ApplyToClientLatent();
@@ -40,8 +33,30 @@ void ALiveLinkAugmentaManager::BeginPlay()
 		UE_LOG(LogLiveLinkAugmenta, Log, TEXT("LiveLinkAugmentaManager: Live Link preset is empty. Make sure to apply the correct Live Link preset yourself (using the Default preset in Project Settings -> Live Link for example)."));
 	}
 
-	//Wait 5 seconds for the preset to load then try to find Live Link Source
-	GetWorld()->GetTimerManager().SetTimer(SearchSourceTimerHandle, this, &ALiveLinkAugmentaManager::SearchLiveLinkSource, SourceSearchDelay, false);
+	//Attach as soon as the source of our scene is registered, which can be later when the preset loads
+	SourceRegisteredHandle = FLiveLinkAugmentaSourceRegistry::Get().OnSourceRegistered.AddUObject(this, &ALiveLinkAugmentaManager::OnAugmentaSourceRegistered);
+	SourceUnregisteredHandle = FLiveLinkAugmentaSourceRegistry::Get().OnSourceUnregistered.AddUObject(this, &ALiveLinkAugmentaManager::OnAugmentaSourceUnregistered);
+
+	if (FLiveLinkAugmentaSource* Source = FLiveLinkAugmentaSourceRegistry::Get().FindSource(SceneName))
+	{
+		AttachToLiveLinkSource(Source);
+	}
+	else
+	{
+		UE_LOG(LogLiveLinkAugmenta, Log, TEXT("LiveLinkAugmentaManager: No Augmenta source named %s yet, waiting for it to be created."), *SceneName.ToString());
+	}
+}
+
+void ALiveLinkAugmentaManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FLiveLinkAugmentaSourceRegistry::Get().OnSourceRegistered.Remove(SourceRegisteredHandle);
+	FLiveLinkAugmentaSourceRegistry::Get().OnSourceUnregistered.Remove(SourceUnregisteredHandle);
+	SourceRegisteredHandle.Reset();
+	SourceUnregisteredHandle.Reset();
+
+	DetachFromLiveLinkSource();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
@@ -100,209 +115,354 @@ bool ALiveLinkAugmentaManager::GetAugmentaVideoOutput(FLiveLinkAugmentaVideoOutp
 	return false;
 }
 
-void ALiveLinkAugmentaManager::SearchLiveLinkSource()
+bool ALiveLinkAugmentaManager::SetAugmentaZones(const TArray<FLiveLinkAugmentaZone>& Zones)
 {
+	if (bIsConnected)
+	{
+		LiveLinkAugmentaSource->SetZones(Zones);
+		return true;
+	}
 
-	if (IModularFeatures::Get().IsModularFeatureAvailable(ILiveLinkClient::ModularFeatureName))
+	return false;
+}
+
+void ALiveLinkAugmentaManager::OnAugmentaSourceRegistered(FName RegisteredSceneName, FLiveLinkAugmentaSource* Source)
+{
+	if (RegisteredSceneName == SceneName && Source != LiveLinkAugmentaSource)
 	{
-		FLiveLinkClient& LiveLinkClient = IModularFeatures::Get().GetModularFeature<FLiveLinkClient>(ILiveLinkClient::ModularFeatureName);
+		AttachToLiveLinkSource(Source);
+	}
+}
 
-		TArray<FGuid> AllSources;
-		AllSources.Append(LiveLinkClient.GetSources());
-		//AllSources.Append(LiveLinkClient.GetVirtualSources());
+void ALiveLinkAugmentaManager::OnAugmentaSourceUnregistered(FName UnregisteredSceneName, FLiveLinkAugmentaSource* Source)
+{
+	//Detach before the source is torn down, the registry tells us if another source of our scene is used instead
+	if (bIsConnected && Source == LiveLinkAugmentaSource)
+	{
+		OnLiveLinkAugmentaSourceDestroyed();
+	}
+}
 
-		for (auto& Source : AllSources) {
+void ALiveLinkAugmentaManager::AttachToLiveLinkSource(FLiveLinkAugmentaSource* Source)
+{
+	//A new source replaced the one we were attached to, stop listening to the old one
+	DetachFromLiveLinkSource();
 
-			UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("LiveLinkAugmentaManager: Found source %s of type %s"), *Source.ToString(), *LiveLinkClient.GetSourceType(Source).ToString());
+	LiveLinkAugmentaSource = Source;
 
-			if (LiveLinkClient.GetSourceType(Source).ToString() == "Augmenta") {
+	UE_LOG(LogLiveLinkAugmenta, Log, TEXT("LiveLinkAugmentaManager: Found Augmenta source named %s."), *SceneName.ToString());
 
-				ULiveLinkAugmentaSourceSettings* AugmentaSourceSettings = Cast<ULiveLinkAugmentaSourceSettings>(LiveLinkClient.GetSourceSettings(Source));
+	//Start reading from the current events, the objects already present are picked up by the resync
+	EventRingCursor = LiveLinkAugmentaSource->GetEventRing().GetWriteSequence();
+	UpdateEventRingCursor = LiveLinkAugmentaSource->GetUpdateEventRing().GetWriteSequence();
+	ZoneEventRingCursor = LiveLinkAugmentaSource->GetZoneEventRing().GetWriteSequence();
+	LastReadStateVersion = 0;
+	bNeedsResync = true;
 
-				if (AugmentaSourceSettings && AugmentaSourceSettings->SceneName == SceneName) {
-					LiveLinkAugmentaSource = AugmentaSourceSettings->SourceReference;
-					break;
-				}
-			}
-		}
-	}
+	SourceDestroyedHandle = LiveLinkAugmentaSource->OnLiveLinkAugmentaSourceDestroyed.AddUObject(this, &ALiveLinkAugmentaManager::OnLiveLinkAugmentaSourceDestroyed);
+
+	bIsConnected = true;
+}
 
-	if (LiveLinkAugmentaSource == nullptr) {
-		//Try again in sourceCheckPeriod seconds
-		GetWorld()->GetTimerManager().SetTimer(SearchSourceTimerHandle, this, &ALiveLinkAugmentaManager::SearchLiveLinkSource, SourceSearchDelay, false);
-		UE_LOG(LogLiveLinkAugmenta, Log, TEXT("LiveLinkAugmentaManager: Could not find an Augmenta source named %s. Trying again in %f seconds."), *SceneName.ToString(), SourceSearchDelay);
+void ALiveLinkAugmentaManager::DetachFromLiveLinkSource()
+{
+	if (LiveLinkAugmentaSource)
+	{
+		LiveLinkAugmentaSource->OnLiveLinkAugmentaSourceDestroyed.Remove(SourceDestroyedHandle);
 	}
-	else {
-		GetWorld()->GetTimerManager().ClearTimer(SearchSourceTimerHandle);
-		UE_LOG(LogLiveLinkAugmenta, Log, TEXT("LiveLinkAugmentaManager: Found Augmenta source named %s."), *SceneName.ToString());
 
-		//Bind events
-		LiveLinkAugmentaSource->OnLiveLinkAugmentaSceneUpdated.BindUObject(this, &ALiveLinkAugmentaManager::OnLiveLinkAugmentaSceneUpdated);
-		LiveLinkAugmentaSource->OnLiveLinkAugmentaVideoOutputUpdated.BindUObject(this, &ALiveLinkAugmentaManager::OnLiveLinkAugmentaVideoOutputUpdated);
-		LiveLinkAugmentaSource->OnLiveLinkAugmentaObjectEntered.BindUObject(this, &ALiveLinkAugmentaManager::OnLiveLinkAugmentaObjectEntered);
-		LiveLinkAugmentaSource->OnLiveLinkAugmentaObjectUpdated.BindUObject(this, &ALiveLinkAugmentaManager::OnLiveLinkAugmentaObjectUpdated);
-		LiveLinkAugmentaSource->OnLiveLinkAugmentaObjectWillLeave.BindUObject(this, &ALiveLinkAugmentaManager::OnLiveLinkAugmentaObjectWillLeave);
-		LiveLinkAugmentaSource->OnLiveLinkAugmentaSourceDestroyed.BindUObject(this, &ALiveLinkAugmentaManager::OnLiveLinkAugmentaSourceDestroyed);
+	SourceDestroyedHandle.Reset();
+	CarriedOverUpdates.Reset();
 
-		bIsConnected = true;
-	}
+	bIsConnected = false;
+	LiveLinkAugmentaSource = nullptr;
 }
 
-void ALiveLinkAugmentaManager::OnLiveLinkAugmentaSceneUpdated(FLiveLinkAugmentaScene NewAugmentaScene)
+void ALiveLinkAugmentaManager::OnLiveLinkAugmentaSourceDestroyed()
 {
+	DetachFromLiveLinkSource();
 
-	if(ensure(AugmentaEventDataQueue))
+	BroadcastSourceDestroyed();
+
+	//The registry will tell us when a new source is created for our scene
+	UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaManager: Connected Live Link source was destroyed, waiting for a new source."));
+}
+
+void ALiveLinkAugmentaManager::CoalesceEvent(int ObjectId, int EventType, const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	//Events can overlap with a resync from the latest states, make them consistent with what was already propagated
+	if (ObjectId >= 0 && !EventCoalescer.Contains(ObjectId))
 	{
-		FAugmentaEventData NewEventData;
-		NewEventData.EventType = 0;
-		NewEventData.ObjectId = -1;
+		const FLiveLinkAugmentaObject* TrackedObject = FindTrackedAugmentaObject(ObjectId);
+		const bool bIsTracked = TrackedObject != nullptr;
 
-		AugmentaEventDataQueue->Events.Enqueue(NewEventData);
+		if (EventType == 3 && !bIsTracked)
+		{
+			//An object we never saw entering
+			EventType = 2;
+		}
+		else if (EventType == 2 && bIsTracked)
+		{
+			//An object already entered by the resync
+			EventType = 3;
+		}
+		else if (EventType == 4 && !bIsTracked)
+		{
+			//An object already removed by the resync
+			return;
+		}
+
+		if (EventType == 3 && bIsTracked && TrackedObject->LastUpdateTime > AugmentaObject.LastUpdateTime)
+		{
+			//An entered event read after the newer state of its object was already propagated
+			return;
+		}
 	}
 
-	UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("LiveLinkAugmentaManager: Received event from Live Link: Scene updated."));
+	EventCoalescer.Add(ObjectId, EventType, AugmentaObject);
 }
 
-void ALiveLinkAugmentaManager::OnLiveLinkAugmentaVideoOutputUpdated(FLiveLinkAugmentaVideoOutput NewAugmentaVideoOutput)
+void ALiveLinkAugmentaManager::CoalesceUpdate(const FLiveLinkAugmentaObject& AugmentaObject)
 {
+	//The events may already hold a newer lifecycle of the object, published after this state
+	const FAugmentaCoalescedEvent* Event = EventCoalescer.Find(AugmentaObject.Id);
 
-	if (ensure(AugmentaEventDataQueue))
+	if (!Event || Event->AugmentaObject.LastUpdateTime <= AugmentaObject.LastUpdateTime)
 	{
-		FAugmentaEventData NewEventData;
-		NewEventData.EventType = 1;
-		NewEventData.ObjectId = -2;
-
-		AugmentaEventDataQueue->Events.Enqueue(NewEventData);
+		CoalesceEvent(AugmentaObject.Id, 3, AugmentaObject);
 	}
-
-	UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Live Link VideoOutput updated."));
 }
 
-void ALiveLinkAugmentaManager::OnLiveLinkAugmentaObjectEntered(FLiveLinkAugmentaObject AugmentaObject)
+void ALiveLinkAugmentaManager::CoalesceResyncEvents()
 {
+	ChangedObjectStates.Reset();
+	LastReadStateVersion = LiveLinkAugmentaSource->GetObjectStateSlots().ReadChangedSince(0, ChangedObjectStates);
+
+	ResyncObjectIds.Reset();
 
-	if (ensure(AugmentaEventDataQueue))
+	//Objects present in the source
+	for (const FLiveLinkAugmentaObject& AugmentaObject : ChangedObjectStates)
 	{
-		FAugmentaEventData NewEventData;
-		NewEventData.EventType = 2;
-		NewEventData.ObjectId = AugmentaObject.Id;
-		NewEventData.AugmentaObject = AugmentaObject;
+		ResyncObjectIds.Add(AugmentaObject.Id);
+		CoalesceEvent(AugmentaObject.Id, 3, AugmentaObject);
+	}
 
-		AugmentaEventDataQueue->Events.Enqueue(NewEventData);
+	//Objects that left the source while we were not reading
+	for (const TPair<int, FLiveLinkAugmentaObject>& TrackedObject : GetTrackedAugmentaObjects())
+	{
+		if (!ResyncObjectIds.Contains(TrackedObject.Key))
+		{
+			EventCoalescer.Add(TrackedObject.Key, 4, TrackedObject.Value);
+		}
 	}
 
-	UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Received event from Live Link: Object %d entered."), AugmentaObject.Id);
+	//Scene and video output might have changed as well
+	FLiveLinkAugmentaObject SceneEventObject;
+	SceneEventObject.Id = -1;
+	EventCoalescer.Add(-1, 0, SceneEventObject);
+
+	FLiveLinkAugmentaObject VideoOutputEventObject;
+	VideoOutputEventObject.Id = -2;
+	EventCoalescer.Add(-2, 1, VideoOutputEventObject);
 }
 
-void ALiveLinkAugmentaManager::OnLiveLinkAugmentaObjectUpdated(FLiveLinkAugmentaObject AugmentaObject)
+void ALiveLinkAugmentaManager::PropagateLiveLinkEvents()
 {
+	//Do not propagate anything when no source is connected
+	if(!bIsConnected)
+	{
+		return;
+	}
+
+	const TLiveLinkAugmentaEventRing<FAugmentaEventData>& EventRing = LiveLinkAugmentaSource->GetEventRing();
+	const TLiveLinkAugmentaEventRing<FAugmentaEventData>& UpdateEventRing = LiveLinkAugmentaSource->GetUpdateEventRing();
+
+	//Updates are read from the source state slots, skip them in the update ring
+	if (bUseLatestStateSlots)
+	{
+		UpdateEventRingCursor = UpdateEventRing.GetWriteSequence();
+	}
 
-	if (ensure(AugmentaEventDataQueue))
+	const int UnreadEventCount = (int)(EventRing.GetWriteSequence() - EventRingCursor);
+	const int UnreadUpdateEventCount = (int)(UpdateEventRing.GetWriteSequence() - UpdateEventRingCursor);
+
+	if(UnreadEventCount >= EventRing.GetCapacity() * EventQueueCapacityWarningThreshold)
 	{
-		FAugmentaEventData NewEventData;
-		NewEventData.EventType = 3;
-		NewEventData.ObjectId = AugmentaObject.Id;
-		NewEventData.AugmentaObject = AugmentaObject;
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaManager: Unread events count in the Augmenta event ring is reaching critical level: %d events while the total capacity is %d. Objects are entering and leaving faster than this manager reads them."), UnreadEventCount, EventRing.GetCapacity());
+	}
 
-		AugmentaEventDataQueue->Events.Enqueue(NewEventData);
+	if(UnreadUpdateEventCount >= UpdateEventRing.GetCapacity() * EventQueueCapacityWarningThreshold)
+	{
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaManager: Unread events count in the Augmenta update event ring is reaching critical level: %d events while the total capacity is %d. You might need to enable bUseLatestStateSlots or decrease your Augmenta send rate."), UnreadUpdateEventCount, UpdateEventRing.GetCapacity());
 	}
 
-	UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Received event from Live Link: Object %d updated."), AugmentaObject.Id);
+	const double PropagationStartTime = FPlatformTime::Seconds();
 
-}
+	EventCoalescer.Reset();
 
-void ALiveLinkAugmentaManager::OnLiveLinkAugmentaObjectWillLeave(FLiveLinkAugmentaObject AugmentaObject)
-{
+	//Updates carried over from the last frame come first, newer events of the same objects replace their state
+	for (const FLiveLinkAugmentaObject& AugmentaObject : CarriedOverUpdates)
+	{
+		EventCoalescer.Add(AugmentaObject.Id, 3, AugmentaObject);
+	}
 
-	if (ensure(AugmentaEventDataQueue))
+	//Carried over updates are always propagated this frame, so that every update is delivered at most one frame late
+	const int32 GuaranteedUpdateCount = CarriedOverUpdates.Num();
+	CarriedOverUpdates.Reset();
+
+	//Get event data from the rings and coalesce them per object id
+	uint64 LostEvents = EventRing.Read(EventRingCursor, [this](const FAugmentaEventData& EventData)
 	{
-		FAugmentaEventData NewEventData;
-		NewEventData.EventType = 4;
-		NewEventData.ObjectId = AugmentaObject.Id;
-		NewEventData.AugmentaObject = AugmentaObject;
+		CoalesceEvent(EventData.ObjectId, EventData.EventType, EventData.AugmentaObject);
+	});
 
-		AugmentaEventDataQueue->Events.Enqueue(NewEventData);
-	}
+	//Read the updates after the lifecycle events, so that they replace the older states carried by the entered events
+	LostEvents += UpdateEventRing.Read(UpdateEventRingCursor, [this](const FAugmentaEventData& EventData)
+	{
+		CoalesceUpdate(EventData.AugmentaObject);
+	});
 
-	UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Received event from Live Link: Object %d will leave."), AugmentaObject.Id);
-}
+	if (LostEvents > 0)
+	{
+		LostEventCount += (int)LostEvents;
+		bNeedsResync = true;
 
-void ALiveLinkAugmentaManager::OnLiveLinkAugmentaSourceDestroyed()
-{
-	bIsConnected = false;
-	LiveLinkAugmentaSource = nullptr;
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaManager: Lost %d Augmenta events, resynchronizing objects. You might need to enable bUseLatestStateSlots or decrease your Augmenta send rate."), (int)LostEvents);
+	}
 
-	OnAugmentaSourceDestroyed.Broadcast();
+	//Read the latest states after the events, so that they replace the older states carried by the entered events
+	if (bUseLatestStateSlots && !bNeedsResync)
+	{
+		ChangedObjectStates.Reset();
+		LastReadStateVersion = LiveLinkAugmentaSource->GetObjectStateSlots().ReadChangedSince(LastReadStateVersion, ChangedObjectStates);
 
-	//Start searching for a new Live Link Source
-	GetWorld()->GetTimerManager().SetTimer(SearchSourceTimerHandle, this, &ALiveLinkAugmentaManager::SearchLiveLinkSource, SourceSearchDelay, false);
+		for (const FLiveLinkAugmentaObject& AugmentaObject : ChangedObjectStates)
+		{
+			CoalesceUpdate(AugmentaObject);
+		}
+	}
 
-	UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaManager: Connected Live Link source was destroyed, restarting source search."));
-}
+	//Resync after reading the events, the events published meanwhile are reconciled by CoalesceEvent next frame
+	if (bNeedsResync)
+	{
+		bNeedsResync = false;
+		CoalesceResyncEvents();
+	}
 
-void ALiveLinkAugmentaManager::PropagateLiveLinkEvents()
-{
-	//Do not propagate anything when no source is connected
-	if(!bIsConnected)
+	//Update the frame snapshot first so that queries made from event handlers see the whole frame
+	for (const FAugmentaCoalescedEvent& Event : EventCoalescer.GetEvents())
 	{
-		return;
+		if (Event.ObjectId < 0)
+		{
+			continue;
+		}
+
+		if (Event.HasLeft())
+		{
+			UntrackAugmentaObject(Event.ObjectId);
+		}
+		else
+		{
+			TrackAugmentaObject(Event.AugmentaObject);
+		}
 	}
 
-	if(ensure(AugmentaEventDataQueue))
+	FrameEnteredObjects.Reset();
+	FrameUpdatedObjects.Reset();
+	FrameLeftObjects.Reset();
+
+	//Propagate the lifecycle events first, in order. Entered and left events already carry the latest object state.
+	for (const FAugmentaCoalescedEvent& Event : EventCoalescer.GetEvents())
 	{
-		int QueueEventCount = AugmentaEventDataQueue->Events.Count();
-		int QueueCapacity = AUGMENTAEVENTQUEUECAPACITY - 1;
+		if (Event.ObjectId == -1)
+		{
+			PropagateLiveLinkEvent(0, Event.AugmentaObject);
+			continue;
+		}
 
-		if(QueueEventCount >= QueueCapacity * EventQueueCapacityWarningThreshold)
+		if (Event.ObjectId == -2)
 		{
-			UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaManager: Events count in the Augmenta event queue is reaching critical level: %d events while the total capacity is %d. You might need to decrease your Augmenta send rate."), QueueEventCount, QueueCapacity);
+			PropagateLiveLinkEvent(1, Event.AugmentaObject);
+			continue;
 		}
 
-		EventDataCache.Empty();
+		if (Event.HasEntered())
+		{
+			PropagateLiveLinkEvent(2, Event.AugmentaObject);
+		}
 
-		while(AugmentaEventDataQueue->Events.Count() > 0)
+		if (Event.HasLeft())
 		{
-			FAugmentaEventData NewEventData;
-
-			//Get event data from queue
-			AugmentaEventDataQueue->Events.Dequeue(NewEventData);
-
-			//Check if an event with this object id as already been extracted from the queue this frame
-			bool bIsIdAlreadyInList = false;
-			int IdIndexInList = -1;
-
-			for(int i=0; i<EventDataCache.Num(); i++)
-			{
-				if(EventDataCache[i].ObjectId == NewEventData.ObjectId)
-				{
-					bIsIdAlreadyInList = true;
-					IdIndexInList = i;
-					break;
-				}
-			}
-
-			if(bIsIdAlreadyInList)
-			{
-				//Update already extracted event for this id
-				EventDataCache[IdIndexInList].EventType = NewEventData.EventType;
-				EventDataCache[IdIndexInList].AugmentaObject = NewEventData.AugmentaObject;
-			} else
-			{
-				//Add new event for this id
-				EventDataCache.Add(NewEventData);
-			}
+			PropagateLiveLinkEvent(4, Event.AugmentaObject);
 		}
+	}
 
-		for (FAugmentaEventData Event : EventDataCache)
+	//Then the updates, as long as the time budget allows
+	const double BudgetEndTime = PropagationStartTime + PropagationTimeBudget * 0.001;
+	int32 PropagatedUpdateCount = 0;
+
+	for (const FAugmentaCoalescedEvent& Event : EventCoalescer.GetEvents())
+	{
+		//Objects entered and updated during the frame get both events, listeners of the updates only still see them at once
+		if (Event.ObjectId < 0 || Event.HasLeft() || !Event.HasUpdated())
 		{
-			PropagateLiveLinkEventFromEventData(Event);
+			continue;
 		}
 
-		UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("LiveLinkAugmentaManager: Propagated %d of %d Augmenta events after sorting."), EventDataCache.Num(), QueueEventCount);
+		//The oldest updates come first in the coalescer, starting with the carried over ones
+		if (PropagationTimeBudget > 0 && PropagatedUpdateCount >= GuaranteedUpdateCount && (CarriedOverUpdates.Num() > 0 || FPlatformTime::Seconds() > BudgetEndTime))
+		{
+			CarriedOverUpdates.Add(Event.AugmentaObject);
+			continue;
+		}
+
+		PropagateLiveLinkEvent(3, Event.AugmentaObject);
+		PropagatedUpdateCount++;
+	}
+
+	CarriedOverEventCount = CarriedOverUpdates.Num();
+
+	if (CarriedOverEventCount > 0)
+	{
+		BudgetOverrunCount++;
+		TotalCarriedOverEventCount += CarriedOverEventCount;
+
+		UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("LiveLinkAugmentaManager: Propagation time budget exceeded, carrying %d object updates over to the next frame."), CarriedOverEventCount);
+	}
+
+	//Propagate the whole frame at once
+	if (bIsConnected && (FrameEnteredObjects.Num() > 0 || FrameUpdatedObjects.Num() > 0 || FrameLeftObjects.Num() > 0))
+	{
+		BroadcastFrame(FrameEnteredObjects, FrameUpdatedObjects, FrameLeftObjects);
+	}
+
+	UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("LiveLinkAugmentaManager: Propagated %d of %d Augmenta events after sorting."), EventCoalescer.Num(), UnreadEventCount + UnreadUpdateEventCount);
+
+	PropagateZoneEvents();
+}
+
+void ALiveLinkAugmentaManager::PropagateZoneEvents()
+{
+	//A zone event handler can disconnect us
+	if (!bIsConnected)
+	{
+		return;
+	}
+
+	const uint64 LostZoneEvents = LiveLinkAugmentaSource->GetZoneEventRing().Read(ZoneEventRingCursor, [this](const FLiveLinkAugmentaZoneEvent& ZoneEvent)
+	{
+		BroadcastZoneEvent(ZoneEvent);
+	});
+
+	if (LostZoneEvents > 0)
+	{
+		LostZoneEventCount += (int)LostZoneEvents;
+
+		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaManager: Lost %d Augmenta zone events."), (int)LostZoneEvents);
 	}
 }
 
-void ALiveLinkAugmentaManager::PropagateLiveLinkEventFromEventData(FAugmentaEventData EventData)
+void ALiveLinkAugmentaManager::PropagateLiveLinkEvent(int EventType, const FLiveLinkAugmentaObject& AugmentaObject)
 {
 	//Check if we have a valid Live Link source to propagate data from
 	if(!bIsConnected)
@@ -310,12 +470,12 @@ void ALiveLinkAugmentaManager::PropagateLiveLinkEventFromEventData(FAugmentaEven
 		return;
 	}
 
-	switch (EventData.EventType)
+	switch (EventType)
 	{
 	case 0: //Scene updated
 	{
 		const FLiveLinkAugmentaScene AugmentaScene = LiveLinkAugmentaSource->GetAugmentaScene();
-		OnAugmentaSceneUpdated.Broadcast(AugmentaScene);
+		BroadcastSceneUpdated(AugmentaScene);
 		UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Propagating Scene Updated event."));
 	}
 		break;
@@ -323,29 +483,32 @@ void ALiveLinkAugmentaManager::PropagateLiveLinkEventFromEventData(FAugmentaEven
 	case 1: //Video Output updated
 	{
 		const FLiveLinkAugmentaVideoOutput AugmentaVideoOutput = LiveLinkAugmentaSource->GetAugmentaVideoOutput();
-		OnAugmentaVideoOutputUpdated.Broadcast(AugmentaVideoOutput);
+		BroadcastVideoOutputUpdated(AugmentaVideoOutput);
 		UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Propagating Video Output Updated event."));
 	}
 		break;
 
 	case 2: //Object entered
 	{
-		OnAugmentaObjectEntered.Broadcast(EventData.AugmentaObject);
-		UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Propagating Object Entered event for object %d."), EventData.ObjectId);
+		FrameEnteredObjects.Add(AugmentaObject);
+		BroadcastObjectEntered(AugmentaObject);
+		UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Propagating Object Entered event for object %d."), AugmentaObject.Id);
 	}
 		break;
 
 	case 3: //Object updated
 	{
-		OnAugmentaObjectUpdated.Broadcast(EventData.AugmentaObject);
-		UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Propagating Object Updated event for object %d."), EventData.ObjectId);
+		FrameUpdatedObjects.Add(AugmentaObject);
+		BroadcastObjectUpdated(AugmentaObject);
+		UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Propagating Object Updated event for object %d."), AugmentaObject.Id);
 	}
 		break;
 
 	case 4: //Object left
 	{
-		OnAugmentaObjectLeft.Broadcast(EventData.AugmentaObject);
-		UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Propagating Object Left event for object %d."), EventData.ObjectId);
+		FrameLeftObjects.Add(AugmentaObject);
+		BroadcastObjectLeft(AugmentaObject);
+		UE_LOG(LogLiveLinkAugmenta, VeryVerbose, TEXT("LiveLinkAugmentaManager: Propagating Object Left event for object %d."), AugmentaObject.Id);
 	}
 		break;
 
@@ -0,0 +1,54 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaObjectStateSlots.h"
+
+#include "Misc/ScopeRWLock.h"
+
+void FLiveLinkAugmentaObjectStateSlots::Write(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	FWriteScopeLock Lock(SlotsLock);
+
+	FSlot& Slot = Slots.FindOrAdd(AugmentaObject.Id);
+	Slot.AugmentaObject = AugmentaObject;
+
+	//Publish the new version last so that readers seeing it also see the slot content
+	Slot.Version = Version.load(std::memory_order_relaxed) + 1;
+	Version.store(Slot.Version, std::memory_order_release);
+}
+
+void FLiveLinkAugmentaObjectStateSlots::Remove(int Id)
+{
+	FWriteScopeLock Lock(SlotsLock);
+
+	Slots.Remove(Id);
+}
+
+void FLiveLinkAugmentaObjectStateSlots::Reset()
+{
+	FWriteScopeLock Lock(SlotsLock);
+
+	Slots.Reset();
+}
+
+uint64 FLiveLinkAugmentaObjectStateSlots::ReadChangedSince(uint64 SinceVersion, TArray<FLiveLinkAugmentaObject>& OutObjects) const
+{
+	//Nothing was written since the last read, do not even take the lock
+	const uint64 CurrentVersion = GetVersion();
+	if (CurrentVersion == SinceVersion)
+	{
+		return CurrentVersion;
+	}
+
+	FReadScopeLock Lock(SlotsLock);
+
+	for (const TPair<int, FSlot>& Slot : Slots)
+	{
+		if (Slot.Value.Version > SinceVersion)
+		{
+			OutObjects.Add(Slot.Value.AugmentaObject);
+		}
+	}
+
+	//Writers are blocked while we hold the lock so every write up to this version has been read
+	return GetVersion();
+}
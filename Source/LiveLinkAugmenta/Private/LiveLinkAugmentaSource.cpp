@@ -2,11 +2,13 @@
 
 #include "LiveLinkAugmentaSource.h"
 #include "LiveLinkAugmenta.h"
+#include "LiveLinkAugmentaSourceRegistry.h"
 #include "ILiveLinkClient.h"
 #include "Engine/Engine.h"
 #include "Async/Async.h"
 #include "LiveLinkAugmentaSourceSettings.h"
 #include "LiveLinkAugmentaData.h"
+#include "LiveLinkAugmentaSchema.h"
 #include "Misc/CoreDelegates.h"
 #include "Roles/LiveLinkTransformRole.h"
 
@@ -20,6 +22,10 @@ FLiveLinkAugmentaSource::FLiveLinkAugmentaSource(const FLiveLinkAugmentaConnecti
 , Thread(nullptr)
 , LocalUpdateRateInHz(ConnectionSettings.LocalUpdateRateInHz)
 , SceneName(ConnectionSettings.SceneName)
+, EventRing(AUGMENTAEVENTRINGCAPACITY)
+, UpdateEventRing(AUGMENTAUPDATEEVENTRINGCAPACITY)
+, ZoneEventRing(AUGMENTAZONEEVENTRINGCAPACITY)
+, FrameBuffer(AUGMENTAFRAMEBUFFERCAPACITY)
 {
 	SourceStatus = LOCTEXT("SourceStatus_NoData", "No data");
 	SourceType = LOCTEXT("SourceType_Augmenta", "Augmenta");
@@ -28,12 +34,25 @@ FLiveLinkAugmentaSource::FLiveLinkAugmentaSource(const FLiveLinkAugmentaConnecti
 	FIPv4Address::Parse(ConnectionSettings.IPAddress, DeviceEndpoint.Address);
 	DeviceEndpoint.Port = ConnectionSettings.PortNumber;
 
-	Socket = FUdpSocketBuilder(TEXT("AugmentaListenerSocket"))
+	FUdpSocketBuilder SocketBuilder = FUdpSocketBuilder(TEXT("AugmentaListenerSocket"))
 		.AsNonBlocking()
 		.AsReusable()
-		.BoundToEndpoint(DeviceEndpoint)
 		.WithReceiveBufferSize(ReceiveBufferSize);
 
+	//Several nDisplay nodes can receive the same stream through a multicast group
+	if (DeviceEndpoint.Address.IsMulticastAddress())
+	{
+		SocketBuilder.BoundToEndpoint(FIPv4Endpoint(FIPv4Address::Any, DeviceEndpoint.Port))
+			.JoinedToGroup(DeviceEndpoint.Address)
+			.WithMulticastLoopback();
+	}
+	else
+	{
+		SocketBuilder.BoundToEndpoint(DeviceEndpoint);
+	}
+
+	Socket = SocketBuilder.Build();
+
 	if ((Socket != nullptr) && (Socket->GetSocketType() == SOCKTYPE_Datagram))
 	{
 		ReceiveBuffer.SetNumUninitialized(ReceiveBufferSize);
@@ -50,6 +69,8 @@ FLiveLinkAugmentaSource::FLiveLinkAugmentaSource(const FLiveLinkAugmentaConnecti
 
 FLiveLinkAugmentaSource::~FLiveLinkAugmentaSource()
 {
+	FLiveLinkAugmentaSourceRegistry::Get().UnregisterSource(this);
+
 	// This could happen if the object is destroyed before FCoreDelegates::OnEndFrame calls FLiveLinkAugmentaSource::Start
 	if (DeferredStartDelegateHandle.IsValid())
 	{
@@ -72,10 +93,7 @@ FLiveLinkAugmentaSource::~FLiveLinkAugmentaSource()
 		Socket = nullptr;
 	}
 
-	if(OnLiveLinkAugmentaSourceDestroyed.IsBound())
-	{
-		OnLiveLinkAugmentaSourceDestroyed.Execute();
-	}
+	OnLiveLinkAugmentaSourceDestroyed.Broadcast();
 
 	UE_LOG(LogLiveLinkAugmenta, Log, TEXT("LiveLinkAugmentaSource: Closed scene %s with IP address %s"), *SceneName.ToString(), *DeviceEndpoint.ToString());
 }
@@ -84,6 +102,8 @@ void FLiveLinkAugmentaSource::ReceiveClient(ILiveLinkClient* InClient, FGuid InS
 {
 	Client = InClient;
 	SourceGuid = InSourceGuid;
+
+	SubjectPusher.Initialize(Client, SourceGuid, SceneName);
 }
 
 void FLiveLinkAugmentaSource::InitializeSettings(ULiveLinkSourceSettings* Settings) {
@@ -96,10 +116,17 @@ void FLiveLinkAugmentaSource::InitializeSettings(ULiveLinkSourceSettings* Settin
 		SavedSourceSettings->SourceReference = this;
 
 		TimeoutDuration = SavedSourceSettings->TimeoutDuration;
+		ObjectExtraWaitTime = SavedSourceSettings->ObjectExtraWaitTime;
 		bApplyObjectHeight = SavedSourceSettings->bApplyObjectHeight;
 		bApplyObjectScale = SavedSourceSettings->bApplyObjectScale;
 		bOffsetObjectPositionOnCentroid = SavedSourceSettings->bOffsetObjectPositionOnCentroid;
 		bDisableSubjectsUpdate = SavedSourceSettings->bDisableSubjectsUpdate;
+		bBufferFrames = SavedSourceSettings->bBufferFrames;
+
+		SetZones(SavedSourceSettings->Zones);
+
+		//Let the managers know this source is ready
+		FLiveLinkAugmentaSourceRegistry::Get().RegisterSource(this);
 	}
 }
 
@@ -121,10 +148,19 @@ void FLiveLinkAugmentaSource::OnSettingsChanged(ULiveLinkSourceSettings* Setting
 		if (SourceSettings != nullptr)
 		{
 			TimeoutDuration = SavedSourceSettings->TimeoutDuration;
+			ObjectExtraWaitTime = SavedSourceSettings->ObjectExtraWaitTime;
 			bApplyObjectHeight = SavedSourceSettings->bApplyObjectHeight;
 			bApplyObjectScale = SavedSourceSettings->bApplyObjectScale;
 			bOffsetObjectPositionOnCentroid = SavedSourceSettings->bOffsetObjectPositionOnCentroid;
 			bDisableSubjectsUpdate = SavedSourceSettings->bDisableSubjectsUpdate;
+			bBufferFrames = SavedSourceSettings->bBufferFrames;
+
+			if (!bBufferFrames)
+			{
+				FrameBuffer.Reset();
+			}
+
+			SetZones(SavedSourceSettings->Zones);
 		}
 	}
 }
@@ -170,7 +206,9 @@ uint32 FLiveLinkAugmentaSource::Run()
 
 	while (!Stopping)
 	{
-		if (Socket && Socket->Wait(ESocketWaitConditions::WaitForRead, SleepDeltaTime))
+		const bool bHasReceivedData = Socket && Socket->Wait(ESocketWaitConditions::WaitForRead, SleepDeltaTime);
+
+		if (bHasReceivedData)
 		{
 			uint32 PendingDataSize = 0;
 			while (Socket && Socket->HasPendingData(PendingDataSize))
@@ -186,9 +224,18 @@ uint32 FLiveLinkAugmentaSource::Run()
 					}
 				}
 			}
+		}
+
+		//Publish the base messages whose extra message did not arrive in time
+		const bool bHasFlushedObjects = PendingObjectMessages.Num() > 0 && FlushPendingObjectMessages(FPlatformTime::Seconds() - ObjectExtraWaitTime);
 
+		if (bHasReceivedData || bHasFlushedObjects)
+		{
 			//Remove inactive objects
 			RemoveInactiveObjects();
+
+			//Generate zone events from the new objects positions
+			EvaluateZones();
 		}
 	}
 	
@@ -234,31 +281,17 @@ FLiveLinkAugmentaVideoOutput FLiveLinkAugmentaSource::GetAugmentaVideoOutput()
 	return AugmentaVideoOutput;
 }
 
-void FLiveLinkAugmentaSource::Send(FLiveLinkFrameDataStruct* FrameDataToSend, FName SubjectName)
+void FLiveLinkAugmentaSource::SetZones(const TArray<FLiveLinkAugmentaZone>& Zones)
 {
+	ZoneEngine.SetZones(Zones);
 
-	if (Stopping || (Client == nullptr))
-	{
-		return;
-	}
-
-	if (!EncounteredSubjects.Contains(SubjectName))
-	{
-		FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
-		StaticData.Cast<FLiveLinkTransformStaticData>()->bIsScaleSupported = true;
-		Client->PushSubjectStaticData_AnyThread({ SourceGuid, SubjectName }, ULiveLinkTransformRole::StaticClass(), MoveTemp(StaticData));
-
-		EncounteredSubjects.Add(SubjectName);
-	}
-
-	Client->PushSubjectFrameData_AnyThread({ SourceGuid, SubjectName }, MoveTemp(*FrameDataToSend));
+	bZonesNeedEvaluation = true;
 }
 
 
+
 void FLiveLinkAugmentaSource::HandleOSCPacket(const OSCPP::Server::Packet& Packet)
 {
-	FLiveLinkAugmentaObject CurrentAugmentaObject;
-
 	if (Packet.isBundle()) {
 
 		UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaSource: Received OSC bundle. This should not happen in Augmenta protocol V2."));
@@ -277,11 +310,20 @@ void FLiveLinkAugmentaSource::HandleOSCPacket(const OSCPP::Server::Packet& Packe
 
 		if (msg == "/scene") {
 
+			//Objects still waiting for their extra message belong to the previous frame
+			if (PendingObjectMessages.Num() > 0) {
+				FlushPendingObjectMessages(FPlatformTime::Seconds());
+			}
+
+			//A new frame starts, the objects received since the last /scene message form a complete frame
+			if (bBufferFrames && bHasReceivedScene) {
+				FrameBuffer.Push(AugmentaScene, AugmentaVideoOutput, VideoOutputRevision, AugmentaObjects);
+			}
+
+			bHasReceivedScene = true;
+
 			//Update scene object
-			AugmentaScene.Frame = args.int32();
-			AugmentaScene.ObjectCount = args.int32();
-			AugmentaScene.Size.X = args.float32();
-			AugmentaScene.Size.Y = args.float32();
+			LiveLinkAugmentaSchema::ReadOsc<LiveLinkAugmentaSchema::SceneFields, LiveLinkAugmentaSchema::SceneOscOrder>(args, AugmentaScene);
 
 			AugmentaScene.Position = FVector::ZeroVector;
 
@@ -291,32 +333,20 @@ void FLiveLinkAugmentaSource::HandleOSCPacket(const OSCPP::Server::Packet& Packe
 			AugmentaScene.Scale.Y = AugmentaScene.Size.X;
 			AugmentaScene.Scale.Z = 1;
 
-			if (!bDisableSubjectsUpdate) {
+			if (!bDisableSubjectsUpdate && !Stopping) {
 				//Update scene subject
-				FLiveLinkFrameDataStruct SceneFrameData(FLiveLinkTransformFrameData::StaticStruct());
-				FLiveLinkTransformFrameData* SceneTransformFrameData = SceneFrameData.Cast<FLiveLinkTransformFrameData>();
-
-				SceneTransformFrameData->Transform = FTransform(AugmentaScene.Rotation, AugmentaScene.Position, AugmentaScene.Scale);
-
-				FName CurrentName = FName(SceneName.ToString() + "_Scene");
-				Send(&SceneFrameData, CurrentName);
+				SubjectPusher.PushScene(AugmentaScene);
 			}
 
 			//Send scene updated event
-			if (OnLiveLinkAugmentaSceneUpdated.IsBound())
-			{
-				OnLiveLinkAugmentaSceneUpdated.Execute(AugmentaScene);
-			}
+			FLiveLinkAugmentaObject SceneEventObject;
+			SceneEventObject.Id = -1;
+			PublishEvent(0, SceneEventObject);
 
 		} else if (msg == "/fusion") {
 
 			//Update video output object
-			AugmentaVideoOutput.Offset.X = args.float32() * MetersToUnrealUnits;
-			AugmentaVideoOutput.Offset.Y = args.float32() * MetersToUnrealUnits;
-			AugmentaVideoOutput.Size.X = args.float32();
-			AugmentaVideoOutput.Size.Y = args.float32();
-			AugmentaVideoOutput.Resolution.X = args.int32();
-			AugmentaVideoOutput.Resolution.Y = args.int32();
+			LiveLinkAugmentaSchema::ReadOsc<LiveLinkAugmentaSchema::VideoOutputFields, LiveLinkAugmentaSchema::VideoOutputOscOrder>(args, AugmentaVideoOutput);
 
 			AugmentaVideoOutput.Position.X = (AugmentaScene.Position.X + AugmentaScene.Size.Y * .5f * MetersToUnrealUnits) - AugmentaVideoOutput.Offset.Y - AugmentaVideoOutput.Size.Y * .5f * MetersToUnrealUnits;
 			AugmentaVideoOutput.Position.Y = (AugmentaScene.Position.Y - AugmentaScene.Size.X * .5f * MetersToUnrealUnits) + AugmentaVideoOutput.Offset.X + AugmentaVideoOutput.Size.X * .5f * MetersToUnrealUnits;
@@ -328,65 +358,37 @@ void FLiveLinkAugmentaSource::HandleOSCPacket(const OSCPP::Server::Packet& Packe
 			AugmentaVideoOutput.Scale.Y = AugmentaVideoOutput.Size.X;
 			AugmentaVideoOutput.Scale.Z = 1;
 
-			if (!bDisableSubjectsUpdate) {
-				//Update video output subject
-				FLiveLinkFrameDataStruct VideoOutputFrameData(FLiveLinkTransformFrameData::StaticStruct());
-				FLiveLinkTransformFrameData* VideoOutputTransformFrameData = VideoOutputFrameData.Cast<FLiveLinkTransformFrameData>();
-
-				VideoOutputTransformFrameData->Transform = FTransform(AugmentaVideoOutput.Rotation, AugmentaVideoOutput.Position, AugmentaVideoOutput.Scale);
+			VideoOutputRevision++;
 
-				FName CurrentName = FName(SceneName.ToString() + "_VideoOutput");
-				Send(&VideoOutputFrameData, CurrentName);
+			if (!bDisableSubjectsUpdate && !Stopping) {
+				//Update video output subject
+				SubjectPusher.PushVideoOutput(AugmentaVideoOutput);
 			}
 
 			//Send video output updated event
-			if (OnLiveLinkAugmentaVideoOutputUpdated.IsBound())
-			{
-				OnLiveLinkAugmentaVideoOutputUpdated.Execute(AugmentaVideoOutput);
-			}
+			FLiveLinkAugmentaObject VideoOutputEventObject;
+			VideoOutputEventObject.Id = -2;
+			PublishEvent(1, VideoOutputEventObject);
 
 		} else if (msg == "/object/enter") {
 
 			//Create augmenta object
-			ReadAugmentaObjectFromOSC(&CurrentAugmentaObject, &args);
-
-			if (!AugmentaObjects.Contains(CurrentAugmentaObject.Id)) {
-				AddAugmentaObject(CurrentAugmentaObject);
-			}
+			ReceiveAugmentaObjectFromOSC(2, &args);
 
 		} else if (msg == "/object/update") {
 
 			//Update augmenta object
-			ReadAugmentaObjectFromOSC(&CurrentAugmentaObject, &args);
-
-			if (AugmentaObjects.Contains(CurrentAugmentaObject.Id)) {
-				UpdateAugmentaObject(CurrentAugmentaObject);
-			}
-			else {
-				AddAugmentaObject(CurrentAugmentaObject);
-			}
+			ReceiveAugmentaObjectFromOSC(3, &args);
 		
 		} else if (msg == "/object/leave") {
 
 			//Remove augmenta object
-			ReadAugmentaObjectFromOSC(&CurrentAugmentaObject, &args);
-
-			if (AugmentaObjects.Contains(CurrentAugmentaObject.Id)) {
-				RemoveAugmentaObject(CurrentAugmentaObject);
-			}
+			ReceiveAugmentaObjectFromOSC(4, &args);
 		
-		} else if (msg == "/object/enter/extra") {
+		} else if (msg == "/object/enter/extra" || msg == "/object/update/extra" || msg == "/object/leave/extra") {
 		
-			UpdateAugmentaObjectExtraFromOSC(&args);
-
-		} else if (msg == "/object/update/extra") {
-			
-			UpdateAugmentaObjectExtraFromOSC(&args);
+			ReceiveAugmentaObjectExtraFromOSC(&args);
 
-		} else if (msg == "/object/leave/extra") {
-
-			UpdateAugmentaObjectExtraFromOSC(&args);
-		
 		} else {
 			// Simply print unknown messages
 			UE_LOG(LogLiveLinkAugmenta, Log, TEXT("LiveLinkAugmentaSource: Received unknown OSC message."));
@@ -396,21 +398,9 @@ void FLiveLinkAugmentaSource::HandleOSCPacket(const OSCPP::Server::Packet& Packe
 
 void FLiveLinkAugmentaSource::ReadAugmentaObjectFromOSC(FLiveLinkAugmentaObject* AugmentaObject, OSCPP::Server::ArgStream* Args) {
 
-	AugmentaObject->Frame = Args->int32();
-	AugmentaObject->Id = Args->int32();
-	AugmentaObject->Oid = Args->int32();
-	AugmentaObject->Age = Args->float32();
-	AugmentaObject->Centroid.X = Args->float32();
-	AugmentaObject->Centroid.Y = Args->float32();
-	AugmentaObject->Velocity.X = Args->float32();
-	AugmentaObject->Velocity.Y = Args->float32();
-	AugmentaObject->Orientation = Args->float32();
-	AugmentaObject->BoundingRectPos.X = Args->float32();
-	AugmentaObject->BoundingRectPos.Y = Args->float32();
-	AugmentaObject->BoundingRectSize.X = Args->float32();
-	AugmentaObject->BoundingRectSize.Y = Args->float32();
-	AugmentaObject->BoundingRectRotation = Args->float32();
-	AugmentaObject->Height = Args->float32();
+	LiveLinkAugmentaSchema::ReadOsc<LiveLinkAugmentaSchema::ObjectFields, LiveLinkAugmentaSchema::ObjectOscOrder>(*Args, *AugmentaObject);
+
+	//The transform is computed from the OSC fields
 
 	if (bApplyObjectScale && !bOffsetObjectPositionOnCentroid) {
 		AugmentaObject->Position.X = (.5f - AugmentaObject->BoundingRectPos.Y) * AugmentaScene.Size.Y * MetersToUnrealUnits;
@@ -439,39 +429,171 @@ void FLiveLinkAugmentaSource::ReadAugmentaObjectFromOSC(FLiveLinkAugmentaObject*
 	AugmentaObject->LastUpdateTime = FDateTime::Now();
 }
 
-void FLiveLinkAugmentaSource::UpdateAugmentaObjectExtraFromOSC(OSCPP::Server::ArgStream* Args) {
+void FLiveLinkAugmentaSource::ReceiveAugmentaObjectFromOSC(int EventType, OSCPP::Server::ArgStream* Args) {
+
+	FLiveLinkAugmentaObject AugmentaObject;
+	ReadAugmentaObjectFromOSC(&AugmentaObject, Args);
+
+	//Nothing to pair with until extra messages are received
+	if (!bHasReceivedObjectExtra || ObjectExtraWaitTime <= 0) {
+		CommitAugmentaObject(EventType, AugmentaObject, false);
+		return;
+	}
+
+	FAugmentaPendingObjectMessage& Pending = PendingObjectMessages.FindOrAdd(AugmentaObject.Id);
+
+	if (Pending.bHasBase) {
+		//The extra message of the previous base message was lost
+		Pending.bHasBase = false;
+		CommitAugmentaObject(Pending.EventType, Pending.AugmentaObject, false);
+	}
+
+	if (Pending.bHasExtra) {
+		Pending.bHasExtra = false;
+
+		if (Pending.Frame == AugmentaObject.Frame) {
+			//The extra message arrived first, publish both as one update
+			LiveLinkAugmentaSchema::CopyFields<LiveLinkAugmentaSchema::ObjectFields, LiveLinkAugmentaSchema::ObjectExtraOscOrder>(Pending.AugmentaObject, AugmentaObject);
+			CommitAugmentaObject(EventType, AugmentaObject, true);
+			return;
+		}
+
+		//The base message of the extra message was lost, only keep the extra data as in FlushPendingObjectMessages
+		UE_LOG(LogLiveLinkAugmenta, Verbose, TEXT("LiveLinkAugmentaSource: Base message of frame %d of object %d was lost, applying its extra data alone."), Pending.Frame, AugmentaObject.Id);
+
+		if (FLiveLinkAugmentaObject* ExistingObject = AugmentaObjects.Find(AugmentaObject.Id)) {
+			LiveLinkAugmentaSchema::CopyFields<LiveLinkAugmentaSchema::ObjectFields, LiveLinkAugmentaSchema::ObjectExtraOscOrder>(Pending.AugmentaObject, *ExistingObject);
+		}
+	}
+
+	//Wait for the extra message of this frame
+	Pending.AugmentaObject = AugmentaObject;
+	Pending.Frame = AugmentaObject.Frame;
+	Pending.EventType = EventType;
+	Pending.bHasBase = true;
+	Pending.ReceiveTime = FPlatformTime::Seconds();
+}
+
+void FLiveLinkAugmentaSource::ReceiveAugmentaObjectExtraFromOSC(OSCPP::Server::ArgStream* Args) {
+
+	static_assert(LiveLinkAugmentaSchema::ObjectExtraHeaderCount == 3, "The extra messages start with the Frame, Id and Oid of the object");
 
 	const int Frame = Args->int32();
 	const int Id = Args->int32();
-	const int Oid = Args->int32();
+	Args->int32(); //Oid
+
+	bHasReceivedObjectExtra = true;
+
+	if (ObjectExtraWaitTime <= 0) {
+		//No pairing, apply the extra data to the current state of the object
+		if (FLiveLinkAugmentaObject* AugmentaObject = AugmentaObjects.Find(Id)) {
+			LiveLinkAugmentaSchema::ReadOsc<LiveLinkAugmentaSchema::ObjectFields, LiveLinkAugmentaSchema::ObjectExtraOscOrder>(*Args, *AugmentaObject);
+		}
+		return;
+	}
+
+	FAugmentaPendingObjectMessage& Pending = PendingObjectMessages.FindOrAdd(Id);
+
+	if (Pending.bHasBase && Pending.Frame != Frame) {
+		//The extra message of the waiting base message was lost
+		Pending.bHasBase = false;
+		CommitAugmentaObject(Pending.EventType, Pending.AugmentaObject, false);
+	}
+
+	LiveLinkAugmentaSchema::ReadOsc<LiveLinkAugmentaSchema::ObjectFields, LiveLinkAugmentaSchema::ObjectExtraOscOrder>(*Args, Pending.AugmentaObject);
+
+	if (Pending.bHasBase) {
+		//Both messages of the frame are here, publish them as one update
+		Pending.bHasBase = false;
+		CommitAugmentaObject(Pending.EventType, Pending.AugmentaObject, true);
+		return;
+	}
+
+	//Wait for the base message of this frame
+	Pending.Frame = Frame;
+	Pending.bHasExtra = true;
+	Pending.ReceiveTime = FPlatformTime::Seconds();
+}
 
-	if (AugmentaObjects.Contains(Id)) {
-		AugmentaObjects[Id].Highest.X = Args->float32();
-		AugmentaObjects[Id].Highest.Y = Args->float32();
-		AugmentaObjects[Id].Distance = Args->float32();
-		AugmentaObjects[Id].Reflectivity = Args->float32();
+void FLiveLinkAugmentaSource::CommitAugmentaObject(int EventType, FLiveLinkAugmentaObject& AugmentaObject, bool bHasExtra)
+{
+	//Resolve the object once for the enter, update and leave messages
+	FLiveLinkAugmentaObject* ExistingObject = AugmentaObjects.Find(AugmentaObject.Id);
+
+	if (ExistingObject && !bHasExtra && bHasReceivedObjectExtra) {
+		//Keep the last extra data when the extra message of this frame is missing
+		LiveLinkAugmentaSchema::CopyFields<LiveLinkAugmentaSchema::ObjectFields, LiveLinkAugmentaSchema::ObjectExtraOscOrder>(*ExistingObject, AugmentaObject);
+	}
+
+	if (EventType == 4) {
+		if (ExistingObject) {
+			RemoveAugmentaObject(AugmentaObject);
+		}
+	}
+	else if (!ExistingObject) {
+		AddAugmentaObject(AugmentaObject);
+	}
+	else if (EventType == 3) {
+		UpdateAugmentaObject(*ExistingObject, AugmentaObject);
+	}
+}
+
+bool FLiveLinkAugmentaSource::FlushPendingObjectMessages(double MaxReceiveTime)
+{
+	const double ExpirationTime = FPlatformTime::Seconds() - TimeoutDuration;
+	bool bHasCommitted = false;
+
+	for (auto It = PendingObjectMessages.CreateIterator(); It; ++It) {
+		FAugmentaPendingObjectMessage& Pending = It.Value();
+
+		if (Pending.bHasBase && Pending.ReceiveTime <= MaxReceiveTime) {
+			//The extra message did not arrive in time, publish the base message alone
+			Pending.bHasBase = false;
+			CommitAugmentaObject(Pending.EventType, Pending.AugmentaObject, false);
+			bHasCommitted = true;
+		}
+		else if (Pending.bHasExtra && Pending.ReceiveTime <= MaxReceiveTime) {
+			//The base message was lost, only keep the extra data
+			Pending.bHasExtra = false;
+
+			if (FLiveLinkAugmentaObject* AugmentaObject = AugmentaObjects.Find(It.Key())) {
+				LiveLinkAugmentaSchema::CopyFields<LiveLinkAugmentaSchema::ObjectFields, LiveLinkAugmentaSchema::ObjectExtraOscOrder>(Pending.AugmentaObject, *AugmentaObject);
+			}
+		}
+		else if (!Pending.bHasBase && !Pending.bHasExtra && Pending.ReceiveTime < ExpirationTime) {
+			//The object is gone
+			It.RemoveCurrent();
+		}
 	}
+
+	return bHasCommitted;
 }
 
 void FLiveLinkAugmentaSource::AddAugmentaObject(FLiveLinkAugmentaObject AugmentaObject)
 {
 	//Create new object
 	AugmentaObjects.Emplace(AugmentaObject.Id, AugmentaObject);
+	SpatialIndex.Update(AugmentaObject.Id, FVector2D(AugmentaObject.Position));
+	bZonesNeedEvaluation = true;
 
 	//Update augmenta object subject
 	UpdateAugmentaObjectSubject(AugmentaObject);
 
 	//Send object entered event
-	if (OnLiveLinkAugmentaObjectEntered.IsBound())
-	{
-		OnLiveLinkAugmentaObjectEntered.Execute(AugmentaObject);
-	}
+	PublishEvent(2, AugmentaObject);
+
+	//Publish the state after the entered event so that consumers never see a state before its entered event
+	ObjectStateSlots.Write(AugmentaObject);
 }
 
-void FLiveLinkAugmentaSource::UpdateAugmentaObject(FLiveLinkAugmentaObject AugmentaObject)
+void FLiveLinkAugmentaSource::UpdateAugmentaObject(FLiveLinkAugmentaObject& ExistingObject, const FLiveLinkAugmentaObject& AugmentaObject)
 {
 	//Update existing object
-	AugmentaObjects[AugmentaObject.Id] = AugmentaObject;
+	ExistingObject = AugmentaObject;
+	SpatialIndex.Update(AugmentaObject.Id, FVector2D(AugmentaObject.Position));
+	bZonesNeedEvaluation = true;
+
+	ObjectStateSlots.Write(AugmentaObject);
 
 	if (!bDisableSubjectsUpdate) {
 		//Update augmenta object subject
@@ -479,42 +601,31 @@ void FLiveLinkAugmentaSource::UpdateAugmentaObject(FLiveLinkAugmentaObject Augme
 	}
 
 	//Send object updated event
-	if (OnLiveLinkAugmentaObjectUpdated.IsBound())
-	{
-		OnLiveLinkAugmentaObjectUpdated.Execute(AugmentaObject);
-	}
+	PublishEvent(3, AugmentaObject);
 }
 
 void FLiveLinkAugmentaSource::RemoveAugmentaObject(FLiveLinkAugmentaObject AugmentaObject)
 {
 	if (!bDisableSubjectsUpdate) {
-		FName CurrentName = FName(SceneName.ToString() + "_Object_" + FString::FromInt(AugmentaObject.Oid));
-
-		if (EncounteredSubjects.Contains(CurrentName)) {
-			EncounteredSubjects.Remove(CurrentName);
-			Client->RemoveSubject_AnyThread({ SourceGuid, CurrentName });
-		}
+		SubjectPusher.RemoveObject(AugmentaObject);
 	}
 
+	ObjectStateSlots.Remove(AugmentaObject.Id);
+
 	//Send object will leave event
-	if (OnLiveLinkAugmentaObjectWillLeave.IsBound())
-	{
-		OnLiveLinkAugmentaObjectWillLeave.Execute(AugmentaObject);
-	}
+	PublishEvent(4, AugmentaObject);
 
 	AugmentaObjects.Remove(AugmentaObject.Id);
+	SpatialIndex.Remove(AugmentaObject.Id);
+	bZonesNeedEvaluation = true;
 }
 
 void FLiveLinkAugmentaSource::UpdateAugmentaObjectSubject(FLiveLinkAugmentaObject AugmentaObject)
 {
 	//Update augmenta object subject
-	FLiveLinkFrameDataStruct ObjectFrameData(FLiveLinkTransformFrameData::StaticStruct());
-	FLiveLinkTransformFrameData* ObjectTransformFrameData = ObjectFrameData.Cast<FLiveLinkTransformFrameData>();
-
-	ObjectTransformFrameData->Transform = FTransform(AugmentaObject.Rotation, AugmentaObject.Position, AugmentaObject.Scale);
-
-	FName CurrentName = FName(SceneName.ToString() + "_Object_" + FString::FromInt(AugmentaObject.Oid));
-	Send(&ObjectFrameData, CurrentName);
+	if (!Stopping) {
+		SubjectPusher.PushObject(AugmentaObject);
+	}
 }
 
 void FLiveLinkAugmentaSource::RemoveInactiveObjects()
@@ -534,4 +645,44 @@ void FLiveLinkAugmentaSource::RemoveInactiveObjects()
 	}
 }
 
+void FLiveLinkAugmentaSource::EvaluateZones()
+{
+	if (!bZonesNeedEvaluation)
+	{
+		return;
+	}
+
+	bZonesNeedEvaluation = false;
+
+	if (!ZoneEngine.HasZones())
+	{
+		return;
+	}
+
+	ZoneEvents.Reset();
+	ZoneEngine.Evaluate(SpatialIndex, ZoneEvents);
+
+	//Send zone events
+	for (const FLiveLinkAugmentaZoneEvent& ZoneEvent : ZoneEvents)
+	{
+		ZoneEventRing.Publish(ZoneEvent);
+	}
+}
+
+void FLiveLinkAugmentaSource::PublishEvent(int EventType, const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	FAugmentaEventData EventData;
+	EventData.ObjectId = AugmentaObject.Id;
+	EventData.EventType = EventType;
+	EventData.AugmentaObject = AugmentaObject;
+
+	//Updates go to their own ring so that a high send rate cannot overwrite the lifecycle events
+	if (EventType == 3) {
+		UpdateEventRing.Publish(EventData);
+	}
+	else {
+		EventRing.Publish(EventData);
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
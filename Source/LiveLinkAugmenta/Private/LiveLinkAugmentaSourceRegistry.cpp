@@ -0,0 +1,132 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaSourceRegistry.h"
+
+#include "LiveLinkAugmenta.h"
+#include "LiveLinkAugmentaSource.h"
+
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+
+FLiveLinkAugmentaSourceRegistry& FLiveLinkAugmentaSourceRegistry::Get()
+{
+	static FLiveLinkAugmentaSourceRegistry Registry;
+	return Registry;
+}
+
+void FLiveLinkAugmentaSourceRegistry::RegisterSource(FLiveLinkAugmentaSource* Source)
+{
+	if (!Source)
+	{
+		return;
+	}
+
+	const FName SceneName = Source->GetSceneName();
+
+	{
+		FScopeLock Lock(&SourcesCriticalSection);
+
+		TArray<FLiveLinkAugmentaSource*>& SceneSources = Sources.FindOrAdd(SceneName);
+
+		if (SceneSources.Num() > 0 && SceneSources.Last() == Source)
+		{
+			return;
+		}
+
+		SceneSources.Remove(Source);
+
+		if (SceneSources.Num() > 0)
+		{
+			UE_LOG(LogLiveLinkAugmenta, Warning, TEXT("LiveLinkAugmentaSourceRegistry: Several Augmenta sources use the scene name %s, only the last one will be used."), *SceneName.ToString());
+		}
+
+		SceneSources.Add(Source);
+	}
+
+	UE_LOG(LogLiveLinkAugmenta, Log, TEXT("LiveLinkAugmentaSourceRegistry: Registered Augmenta source for scene %s."), *SceneName.ToString());
+
+	NotifySourceRegistered(SceneName);
+}
+
+void FLiveLinkAugmentaSourceRegistry::NotifySourceRegistered(FName SceneName)
+{
+	if (IsInGameThread())
+	{
+		BroadcastSourceRegistered(SceneName);
+	}
+	else
+	{
+		//The source is looked up again on the game thread in case it was destroyed in between
+		AsyncTask(ENamedThreads::GameThread, [SceneName]()
+		{
+			FLiveLinkAugmentaSourceRegistry::Get().BroadcastSourceRegistered(SceneName);
+		});
+	}
+}
+
+void FLiveLinkAugmentaSourceRegistry::UnregisterSource(FLiveLinkAugmentaSource* Source)
+{
+	if (!Source)
+	{
+		return;
+	}
+
+	const FName SceneName = Source->GetSceneName();
+	bool bHasOtherSource;
+
+	{
+		FScopeLock Lock(&SourcesCriticalSection);
+
+		TArray<FLiveLinkAugmentaSource*>* SceneSources = Sources.Find(SceneName);
+
+		if (!SceneSources || !SceneSources->Contains(Source))
+		{
+			return;
+		}
+
+		//A source that was not used can leave silently
+		if (SceneSources->Last() != Source)
+		{
+			SceneSources->Remove(Source);
+			return;
+		}
+
+		SceneSources->Pop();
+		bHasOtherSource = SceneSources->Num() > 0;
+
+		if (!bHasOtherSource)
+		{
+			Sources.Remove(SceneName);
+		}
+	}
+
+	UE_LOG(LogLiveLinkAugmenta, Log, TEXT("LiveLinkAugmentaSourceRegistry: Unregistered Augmenta source for scene %s."), *SceneName.ToString());
+
+	//The source is being destroyed, listeners must be told right away
+	OnSourceUnregistered.Broadcast(SceneName, Source);
+
+	//The other source of the scene is used again
+	if (bHasOtherSource)
+	{
+		UE_LOG(LogLiveLinkAugmenta, Log, TEXT("LiveLinkAugmentaSourceRegistry: Using the previous Augmenta source registered for scene %s."), *SceneName.ToString());
+
+		NotifySourceRegistered(SceneName);
+	}
+}
+
+FLiveLinkAugmentaSource* FLiveLinkAugmentaSourceRegistry::FindSource(FName SceneName) const
+{
+	FScopeLock Lock(&SourcesCriticalSection);
+
+	const TArray<FLiveLinkAugmentaSource*>* SceneSources = Sources.Find(SceneName);
+
+	return SceneSources && SceneSources->Num() > 0 ? SceneSources->Last() : nullptr;
+}
+
+void FLiveLinkAugmentaSourceRegistry::BroadcastSourceRegistered(FName SceneName)
+{
+	if (FLiveLinkAugmentaSource* Source = FindSource(SceneName))
+	{
+		OnSourceRegistered.Broadcast(SceneName, Source);
+	}
+}
@@ -0,0 +1,260 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaSpatialIndex.h"
+
+FLiveLinkAugmentaSpatialIndex::FLiveLinkAugmentaSpatialIndex(float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.0f);
+	InvCellSize = 1.0 / CellSize;
+}
+
+void FLiveLinkAugmentaSpatialIndex::SetCellSize(float InCellSize)
+{
+	InCellSize = FMath::Max(InCellSize, 1.0f);
+
+	if (InCellSize == CellSize)
+	{
+		return;
+	}
+
+	//Gather current positions before rebuilding the grid
+	TArray<FCellItem> Items;
+	Items.Reserve(Entries.Num());
+	for (const TPair<FIntPoint, TArray<FCellItem>>& Cell : Cells)
+	{
+		Items.Append(Cell.Value);
+	}
+
+	CellSize = InCellSize;
+	InvCellSize = 1.0 / CellSize;
+
+	Reset();
+
+	for (const FCellItem& Item : Items)
+	{
+		Update(Item.Id, Item.Position);
+	}
+}
+
+void FLiveLinkAugmentaSpatialIndex::Update(int Id, const FVector2D& Position)
+{
+	const FIntPoint NewCell = GetCell(Position);
+
+	if (FEntry* Entry = Entries.Find(Id))
+	{
+		if (Entry->Cell == NewCell)
+		{
+			//Object stayed in its cell, only move it
+			Cells.FindChecked(NewCell)[Entry->IndexInCell].Position = Position;
+			return;
+		}
+
+		RemoveFromCell(*Entry);
+
+		TArray<FCellItem>& Cell = Cells.FindOrAdd(NewCell);
+		Entry->Cell = NewCell;
+		Entry->IndexInCell = Cell.Add({ Id, Position });
+	}
+	else
+	{
+		TArray<FCellItem>& Cell = Cells.FindOrAdd(NewCell);
+		Entries.Add(Id, { NewCell, Cell.Add({ Id, Position }) });
+	}
+}
+
+void FLiveLinkAugmentaSpatialIndex::Remove(int Id)
+{
+	FEntry Entry;
+	if (Entries.RemoveAndCopyValue(Id, Entry))
+	{
+		RemoveFromCell(Entry);
+	}
+}
+
+void FLiveLinkAugmentaSpatialIndex::Reset()
+{
+	Entries.Reset();
+	Cells.Reset();
+}
+
+bool FLiveLinkAugmentaSpatialIndex::GetPosition(int Id, FVector2D& OutPosition) const
+{
+	if (const FEntry* Entry = Entries.Find(Id))
+	{
+		OutPosition = Cells.FindChecked(Entry->Cell)[Entry->IndexInCell].Position;
+		return true;
+	}
+
+	return false;
+}
+
+void FLiveLinkAugmentaSpatialIndex::QueryRadius(const FVector2D& Center, double Radius, TArray<int>& OutIds) const
+{
+	if (Radius < 0)
+	{
+		return;
+	}
+
+	const double RadiusSquared = Radius * Radius;
+	const FBox2D Box(Center - FVector2D(Radius), Center + FVector2D(Radius));
+
+	ForEachCandidateInBox(Box, [&](int Id, const FVector2D& Position)
+	{
+		if (FVector2D::DistSquared(Position, Center) <= RadiusSquared)
+		{
+			OutIds.Add(Id);
+		}
+	});
+}
+
+void FLiveLinkAugmentaSpatialIndex::QueryOrientedRect(const FVector2D& Center, const FVector2D& HalfExtents, double RotationDegrees, TArray<int>& OutIds) const
+{
+	double Sin, Cos;
+	FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(RotationDegrees));
+
+	//Axis aligned bounds of the rotated rectangle
+	const FVector2D BoundsExtents(FMath::Abs(HalfExtents.X * Cos) + FMath::Abs(HalfExtents.Y * Sin), FMath::Abs(HalfExtents.X * Sin) + FMath::Abs(HalfExtents.Y * Cos));
+	const FBox2D Box(Center - BoundsExtents, Center + BoundsExtents);
+
+	ForEachCandidateInBox(Box, [&](int Id, const FVector2D& Position)
+	{
+		//Express the position in the rectangle local frame
+		const FVector2D Delta = Position - Center;
+		const double LocalX = Delta.X * Cos + Delta.Y * Sin;
+		const double LocalY = -Delta.X * Sin + Delta.Y * Cos;
+
+		if (FMath::Abs(LocalX) <= HalfExtents.X && FMath::Abs(LocalY) <= HalfExtents.Y)
+		{
+			OutIds.Add(Id);
+		}
+	});
+}
+
+void FLiveLinkAugmentaSpatialIndex::QueryNearest(const FVector2D& Point, int Count, TArray<int>& OutIds, double MaxDistance) const
+{
+	if (Count <= 0 || Entries.Num() == 0)
+	{
+		return;
+	}
+
+	struct FCandidate
+	{
+		double DistanceSquared;
+		int Id;
+	};
+
+	//Best candidates sorted from nearest to farthest
+	TArray<FCandidate, TInlineAllocator<16>> Best;
+	double WorstAcceptedSquared = MaxDistance * MaxDistance;
+
+	auto Consider = [&](int Id, const FVector2D& Position)
+	{
+		const double DistanceSquared = FVector2D::DistSquared(Position, Point);
+		if (DistanceSquared > WorstAcceptedSquared)
+		{
+			return;
+		}
+
+		int32 InsertIndex = Best.Num();
+		while (InsertIndex > 0 && Best[InsertIndex - 1].DistanceSquared > DistanceSquared)
+		{
+			InsertIndex--;
+		}
+		Best.Insert({ DistanceSquared, Id }, InsertIndex);
+
+		if (Best.Num() > Count)
+		{
+			Best.Pop(EAllowShrinking::No);
+		}
+		if (Best.Num() == Count)
+		{
+			WorstAcceptedSquared = Best.Last().DistanceSquared;
+		}
+	};
+
+	//Visit rings of cells around the point until the remaining rings cannot hold a better candidate
+	const FIntPoint CenterCell = GetCell(Point);
+	int32 VisitedItems = 0;
+
+	for (int32 Ring = 0; ; Ring++)
+	{
+		//Too many empty cells to visit, finish with a full scan
+		const int64 RingCellCount = Ring == 0 ? 1 : int64(8) * Ring;
+		if (RingCellCount > Cells.Num())
+		{
+			Best.Reset();
+			WorstAcceptedSquared = MaxDistance * MaxDistance;
+			for (const TPair<FIntPoint, TArray<FCellItem>>& Cell : Cells)
+			{
+				for (const FCellItem& Item : Cell.Value)
+				{
+					Consider(Item.Id, Item.Position);
+				}
+			}
+			break;
+		}
+
+		for (int32 Y = CenterCell.Y - Ring; Y <= CenterCell.Y + Ring; Y++)
+		{
+			const bool bIsEdgeRow = (Y == CenterCell.Y - Ring) || (Y == CenterCell.Y + Ring);
+			const int32 Step = bIsEdgeRow ? 1 : FMath::Max(2 * Ring, 1);
+
+			for (int32 X = CenterCell.X - Ring; X <= CenterCell.X + Ring; X += Step)
+			{
+				if (const TArray<FCellItem>* Cell = Cells.Find(FIntPoint(X, Y)))
+				{
+					for (const FCellItem& Item : *Cell)
+					{
+						Consider(Item.Id, Item.Position);
+					}
+					VisitedItems += Cell->Num();
+				}
+			}
+		}
+
+		//Every point in the next ring is at least Ring cells away from the point
+		const double NextRingDistance = Ring * (double)CellSize;
+		if (VisitedItems >= Entries.Num() || NextRingDistance * NextRingDistance > WorstAcceptedSquared)
+		{
+			break;
+		}
+	}
+
+	OutIds.Reserve(OutIds.Num() + Best.Num());
+	for (const FCandidate& Candidate : Best)
+	{
+		OutIds.Add(Candidate.Id);
+	}
+}
+
+int FLiveLinkAugmentaSpatialIndex::FindNearest(const FVector2D& Point, double MaxDistance) const
+{
+	TArray<int> Nearest;
+	QueryNearest(Point, 1, Nearest, MaxDistance);
+	return Nearest.Num() > 0 ? Nearest[0] : INDEX_NONE;
+}
+
+FIntPoint FLiveLinkAugmentaSpatialIndex::GetCell(const FVector2D& Position) const
+{
+	return FIntPoint(FMath::FloorToInt32(Position.X * InvCellSize), FMath::FloorToInt32(Position.Y * InvCellSize));
+}
+
+void FLiveLinkAugmentaSpatialIndex::RemoveFromCell(const FEntry& Entry)
+{
+	TArray<FCellItem>& Cell = Cells.FindChecked(Entry.Cell);
+
+	//Remove the cell once empty, so the grid does not grow as people walk around and only counts occupied cells
+	if (Cell.Num() == 1)
+	{
+		Cells.Remove(Entry.Cell);
+		return;
+	}
+
+	Cell.RemoveAtSwap(Entry.IndexInCell, 1, EAllowShrinking::No);
+
+	//Fix the index of the item that was swapped into the removed slot
+	if (Entry.IndexInCell < Cell.Num())
+	{
+		Entries.FindChecked(Cell[Entry.IndexInCell].Id).IndexInCell = Entry.IndexInCell;
+	}
+}
@@ -0,0 +1,88 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaSubjectPusher.h"
+
+#include "ILiveLinkClient.h"
+#include "Roles/LiveLinkTransformRole.h"
+#include "Roles/LiveLinkTransformTypes.h"
+
+void FLiveLinkAugmentaSubjectPusher::Initialize(ILiveLinkClient* InClient, FGuid InSourceGuid, FName InSceneName)
+{
+	Client = InClient;
+	SourceGuid = InSourceGuid;
+	SceneName = InSceneName;
+	SceneSubjectName = FName(SceneName.ToString() + "_Scene");
+	VideoOutputSubjectName = FName(SceneName.ToString() + "_VideoOutput");
+
+	EncounteredSubjects.Reset();
+}
+
+void FLiveLinkAugmentaSubjectPusher::PushScene(const FLiveLinkAugmentaScene& AugmentaScene)
+{
+	PushTransform(SceneSubjectName, FTransform(AugmentaScene.Rotation, AugmentaScene.Position, AugmentaScene.Scale));
+}
+
+void FLiveLinkAugmentaSubjectPusher::PushVideoOutput(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput)
+{
+	PushTransform(VideoOutputSubjectName, FTransform(AugmentaVideoOutput.Rotation, AugmentaVideoOutput.Position, AugmentaVideoOutput.Scale));
+}
+
+void FLiveLinkAugmentaSubjectPusher::PushObject(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	PushTransform(GetObjectSubjectName(AugmentaObject), FTransform(AugmentaObject.Rotation, AugmentaObject.Position, AugmentaObject.Scale));
+}
+
+void FLiveLinkAugmentaSubjectPusher::RemoveObject(const FLiveLinkAugmentaObject& AugmentaObject)
+{
+	const FName SubjectName = GetObjectSubjectName(AugmentaObject);
+
+	if (Client && EncounteredSubjects.Remove(SubjectName) > 0)
+	{
+		Client->RemoveSubject_AnyThread({ SourceGuid, SubjectName });
+	}
+}
+
+void FLiveLinkAugmentaSubjectPusher::RemoveObjects()
+{
+	for (auto It = EncounteredSubjects.CreateIterator(); It; ++It)
+	{
+		if (*It == SceneSubjectName || *It == VideoOutputSubjectName)
+		{
+			continue;
+		}
+
+		if (Client)
+		{
+			Client->RemoveSubject_AnyThread({ SourceGuid, *It });
+		}
+
+		It.RemoveCurrent();
+	}
+}
+
+FName FLiveLinkAugmentaSubjectPusher::GetObjectSubjectName(const FLiveLinkAugmentaObject& AugmentaObject) const
+{
+	return FName(SceneName.ToString() + "_Object_" + FString::FromInt(AugmentaObject.Oid));
+}
+
+void FLiveLinkAugmentaSubjectPusher::PushTransform(FName SubjectName, const FTransform& Transform)
+{
+	if (Client == nullptr)
+	{
+		return;
+	}
+
+	if (!EncounteredSubjects.Contains(SubjectName))
+	{
+		FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
+		StaticData.Cast<FLiveLinkTransformStaticData>()->bIsScaleSupported = true;
+		Client->PushSubjectStaticData_AnyThread({ SourceGuid, SubjectName }, ULiveLinkTransformRole::StaticClass(), MoveTemp(StaticData));
+
+		EncounteredSubjects.Add(SubjectName);
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkTransformFrameData::StaticStruct());
+	FrameData.Cast<FLiveLinkTransformFrameData>()->Transform = Transform;
+
+	Client->PushSubjectFrameData_AnyThread({ SourceGuid, SubjectName }, MoveTemp(FrameData));
+}
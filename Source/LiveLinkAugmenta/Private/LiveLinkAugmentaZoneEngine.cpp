@@ -0,0 +1,137 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#include "LiveLinkAugmentaZoneEngine.h"
+
+#include "Misc/ScopeLock.h"
+
+bool FLiveLinkAugmentaZone::Contains(const FVector2D& Point) const
+{
+	if (Shape == EAugmentaZoneShape::Circle)
+	{
+		return FVector2D::DistSquared(Point, Center) <= Radius * Radius;
+	}
+
+	//Crossing number test
+	bool bInside = false;
+	const int32 PointCount = Points.Num();
+
+	for (int32 i = 0, j = PointCount - 1; i < PointCount; j = i++)
+	{
+		const FVector2D& A = Points[i];
+		const FVector2D& B = Points[j];
+
+		if ((A.Y > Point.Y) != (B.Y > Point.Y) && Point.X < (B.X - A.X) * (Point.Y - A.Y) / (B.Y - A.Y) + A.X)
+		{
+			bInside = !bInside;
+		}
+	}
+
+	return bInside;
+}
+
+FBox2D FLiveLinkAugmentaZone::GetBounds() const
+{
+	if (Shape == EAugmentaZoneShape::Circle)
+	{
+		return FBox2D(Center - FVector2D(Radius), Center + FVector2D(Radius));
+	}
+
+	return FBox2D(Points);
+}
+
+void FLiveLinkAugmentaZoneEngine::SetZones(const TArray<FLiveLinkAugmentaZone>& InZones)
+{
+	FScopeLock Lock(&ZonesCriticalSection);
+
+	TArray<FZoneState> PreviousZones = MoveTemp(Zones);
+	Zones.Reset(InZones.Num());
+
+	for (const FLiveLinkAugmentaZone& Zone : InZones)
+	{
+		//Ignore degenerate polygons
+		if (Zone.Shape == EAugmentaZoneShape::Polygon && Zone.Points.Num() < 3)
+		{
+			continue;
+		}
+
+		FZoneState& ZoneState = Zones.AddDefaulted_GetRef();
+		ZoneState.Zone = Zone;
+		ZoneState.Bounds = Zone.GetBounds();
+
+		if (FZoneState* PreviousZone = PreviousZones.FindByPredicate([&Zone](const FZoneState& State) { return State.Zone.Name == Zone.Name; }))
+		{
+			ZoneState.Occupants = MoveTemp(PreviousZone->Occupants);
+		}
+	}
+}
+
+bool FLiveLinkAugmentaZoneEngine::HasZones() const
+{
+	FScopeLock Lock(&ZonesCriticalSection);
+
+	return Zones.Num() > 0;
+}
+
+void FLiveLinkAugmentaZoneEngine::Evaluate(const FLiveLinkAugmentaSpatialIndex& SpatialIndex, TArray<FLiveLinkAugmentaZoneEvent>& OutEvents)
+{
+	FScopeLock Lock(&ZonesCriticalSection);
+
+	auto AddEvent = [&OutEvents](EAugmentaZoneEventType Type, FName ZoneName, int ObjectId, int Occupancy)
+	{
+		FLiveLinkAugmentaZoneEvent& ZoneEvent = OutEvents.AddDefaulted_GetRef();
+		ZoneEvent.Type = Type;
+		ZoneEvent.ZoneName = ZoneName;
+		ZoneEvent.ObjectId = ObjectId;
+		ZoneEvent.Occupancy = Occupancy;
+	};
+
+	for (FZoneState& ZoneState : Zones)
+	{
+		NewOccupants.Reset();
+
+		SpatialIndex.ForEachCandidateInBox(ZoneState.Bounds, [&](int Id, const FVector2D& Position)
+		{
+			if (ZoneState.Zone.Contains(Position))
+			{
+				NewOccupants.Add(Id);
+			}
+		});
+
+		NewOccupants.Sort();
+
+		//Merge the sorted occupant lists to find who entered and who left
+		const int32 PreviousOccupancy = ZoneState.Occupants.Num();
+		int32 Occupancy = PreviousOccupancy;
+		int32 OldIndex = 0;
+		int32 NewIndex = 0;
+
+		while (OldIndex < ZoneState.Occupants.Num() || NewIndex < NewOccupants.Num())
+		{
+			const int OldId = OldIndex < ZoneState.Occupants.Num() ? ZoneState.Occupants[OldIndex] : MAX_int32;
+			const int NewId = NewIndex < NewOccupants.Num() ? NewOccupants[NewIndex] : MAX_int32;
+
+			if (OldId == NewId)
+			{
+				OldIndex++;
+				NewIndex++;
+			}
+			else if (NewId < OldId)
+			{
+				AddEvent(EAugmentaZoneEventType::Enter, ZoneState.Zone.Name, NewId, ++Occupancy);
+				NewIndex++;
+			}
+			else
+			{
+				AddEvent(EAugmentaZoneEventType::Leave, ZoneState.Zone.Name, OldId, --Occupancy);
+				OldIndex++;
+			}
+		}
+
+		if (Occupancy != PreviousOccupancy)
+		{
+			AddEvent(EAugmentaZoneEventType::OccupancyChanged, ZoneState.Zone.Name, -1, Occupancy);
+		}
+
+		Swap(ZoneState.Occupants, NewOccupants);
+	}
+}
@@ -0,0 +1,85 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "LiveLinkAugmentaData.h"
+
+#include "CoreMinimal.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "AugmentaCrowdVisualizerComponent.generated.h"
+
+/** Forward Declarations */
+class ALiveLinkAugmentaEventDispatcher;
+
+/**
+ * Renders every Augmenta object as one instance of a static mesh.
+ * Instance transforms are relative to this component, so it should be placed where the Augmenta scene is.
+ * All transforms are sent to the renderer in a single bulk update per frame and the instances of objects
+ * that left are hidden and reused for the next objects entering.
+ */
+UCLASS(ClassGroup = (Augmenta), meta = (BlueprintSpawnableComponent), Category = "Augmenta")
+class LIVELINKAUGMENTA_API UAugmentaCrowdVisualizerComponent : public UInstancedStaticMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UAugmentaCrowdVisualizerComponent(const FObjectInitializer& ObjectInitializer);
+
+	// Augmenta Event Dispatcher to visualize. If empty, the owner is used when it is an Augmenta Event Dispatcher.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta")
+	ALiveLinkAugmentaEventDispatcher* AugmentaEventDispatcher;
+
+	// Use the object scale (bounding box size and height) as instance scale.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Visualizer")
+	bool bApplyObjectScale = true;
+
+	// Scale applied to every instance, on top of the object scale.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Visualizer")
+	FVector InstanceScale = FVector::OneVector;
+
+	/**
+	*  Change the visualized Augmenta Event Dispatcher
+	*  @param  NewAugmentaEventDispatcher		The dispatcher to visualize, can be null
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Augmenta|Visualizer")
+	void SetAugmentaEventDispatcher(ALiveLinkAugmentaEventDispatcher* NewAugmentaEventDispatcher);
+
+	// Get the number of objects currently visualized
+	UFUNCTION(BlueprintPure, Category = "Augmenta|Visualizer")
+	int GetVisualizedObjectCount() const { return ObjectIdToInstance.Num(); }
+
+protected:
+
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+
+	void BindToDispatcher();
+	void UnbindFromDispatcher();
+
+	void OnAugmentaFrame(const TArray<FLiveLinkAugmentaObject>& EnteredObjects, const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects);
+	void OnAugmentaSourceDestroyed();
+
+	void ShowObject(const FLiveLinkAugmentaObject& AugmentaObject);
+	void HideObject(int Id);
+
+	// Send all instance transforms to the renderer
+	void FlushInstanceTransforms();
+
+	FTransform GetInstanceTransform(const FLiveLinkAugmentaObject& AugmentaObject) const;
+
+	// Dispatcher we are currently bound to
+	TWeakObjectPtr<ALiveLinkAugmentaEventDispatcher> BoundDispatcher;
+
+	// Object Id -> instance index
+	TMap<int, int32> ObjectIdToInstance;
+
+	// Hidden instances ready to be reused
+	TArray<int32> FreeInstances;
+
+	// Transforms of every instance, including hidden ones, in instance order
+	TArray<FTransform> InstanceTransforms;
+};
@@ -0,0 +1,107 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "LiveLinkAugmentaEventDispatcher.h"
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "AugmentaObjectTrackerComponent.generated.h"
+
+UENUM(BlueprintType)
+enum class EAugmentaObjectTrackingMode : uint8
+{
+	// Track the object with the given Id
+	ObjectId,
+	// Track the object nearest to the tracking point, re-evaluated every frame
+	NearestToPoint
+};
+
+/**
+ * Follows a single Augmenta object of an Augmenta Event Dispatcher.
+ * The component subscribes to the tracked object only, so it is not called for the other objects of the scene.
+ */
+UCLASS(ClassGroup = (Augmenta), meta = (BlueprintSpawnableComponent), Category = "Augmenta")
+class LIVELINKAUGMENTA_API UAugmentaObjectTrackerComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UAugmentaObjectTrackerComponent();
+
+	// Augmenta Event Dispatcher providing the objects. If empty, the owner is used when it is an Augmenta Event Dispatcher.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta")
+	ALiveLinkAugmentaEventDispatcher* AugmentaEventDispatcher;
+
+	// How the tracked object is chosen
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Tracker")
+	EAugmentaObjectTrackingMode TrackingMode = EAugmentaObjectTrackingMode::ObjectId;
+
+	// Id of the tracked object in ObjectId mode
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Tracker", meta = (EditCondition = "TrackingMode == EAugmentaObjectTrackingMode::ObjectId"))
+	int TrackedObjectId = 0;
+
+	// Point in Augmenta scene space in NearestToPoint mode. Only the X and Y coordinates are used.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Tracker", meta = (EditCondition = "TrackingMode == EAugmentaObjectTrackingMode::NearestToPoint"))
+	FVector TrackingPoint = FVector::ZeroVector;
+
+	// Objects farther than this distance from the tracking point are ignored in NearestToPoint mode. Zero or less means no limit.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Tracker", meta = (EditCondition = "TrackingMode == EAugmentaObjectTrackingMode::NearestToPoint"))
+	float MaxDistance = 0;
+
+	// A delegate that is fired when the tracked object entered the scene, or became the nearest object in NearestToPoint mode.
+	UPROPERTY(BlueprintAssignable, Category = "Augmenta|Events")
+	FAugmentaObjectUpdatedEvent OnTrackedObjectEntered;
+
+	// A delegate that is fired when the tracked object has been updated.
+	UPROPERTY(BlueprintAssignable, Category = "Augmenta|Events")
+	FAugmentaObjectUpdatedEvent OnTrackedObjectUpdated;
+
+	// A delegate that is fired when the tracked object left the scene, or is no longer the nearest object in NearestToPoint mode, or when the source is destroyed.
+	UPROPERTY(BlueprintAssignable, Category = "Augmenta|Events")
+	FAugmentaObjectUpdatedEvent OnTrackedObjectLeft;
+
+	// Track the object with the given Id
+	UFUNCTION(BlueprintCallable, Category = "Augmenta|Tracker")
+	void TrackObjectId(int Id);
+
+	// Track the object nearest to a point
+	UFUNCTION(BlueprintCallable, Category = "Augmenta|Tracker")
+	void TrackNearestToPoint(FVector Point, float InMaxDistance);
+
+	/**
+	*  Get the tracked object as of the last propagated frame
+	*  @param  AugmentaObject		The tracked object
+	*  @return FALSE if the tracked object is not in the scene
+	*/
+	UFUNCTION(BlueprintPure, Category = "Augmenta|Tracker")
+	bool GetTrackedObject(FLiveLinkAugmentaObject& AugmentaObject) const;
+
+protected:
+
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+
+	void OnTrackedObjectEvent(const FLiveLinkAugmentaObject& AugmentaObject, EAugmentaLifecycleFlags Event);
+	void OnAugmentaFrame(const TArray<FLiveLinkAugmentaObject>& EnteredObjects, const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects);
+	void OnAugmentaSourceDestroyed();
+
+	// Subscribe to a new object, firing left for the previous one and entered for the new one when they are in the scene
+	void SetSubscribedObject(int Id);
+
+	void Unsubscribe();
+
+	// Dispatcher we are currently bound to
+	TWeakObjectPtr<ALiveLinkAugmentaEventDispatcher> BoundDispatcher;
+
+	// Id of the object we are subscribed to, INDEX_NONE if none
+	int SubscribedObjectId = INDEX_NONE;
+
+	FDelegateHandle SubscriptionHandle;
+	FDelegateHandle FrameHandle;
+	FDelegateHandle SourceDestroyedHandle;
+};
@@ -0,0 +1,134 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "LiveLinkAugmentaData.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Interface.h"
+#include "LiveLinkAugmentaActorPool.generated.h"
+
+/** Forward Declarations */
+class ALiveLinkAugmentaEventDispatcher;
+
+UINTERFACE(MinimalAPI, Blueprintable)
+class UAugmentaPooledActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Optional interface for the actors of an Augmenta Actor Pool.
+ * Pooled actors are reused for several Augmenta objects, so any per-object state should be reset in OnAugmentaObjectActivated.
+ */
+class LIVELINKAUGMENTA_API IAugmentaPooledActor
+{
+	GENERATED_BODY()
+
+public:
+
+	// Called when the actor is taken from the pool to represent an Augmenta object.
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Augmenta|Actor Pool")
+	void OnAugmentaObjectActivated(const FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Called when the Augmenta object represented by the actor has been updated.
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Augmenta|Actor Pool")
+	void OnAugmentaObjectUpdated(const FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Called when the Augmenta object represented by the actor left and the actor goes back to the pool.
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Augmenta|Actor Pool")
+	void OnAugmentaObjectDeactivated(const FLiveLinkAugmentaObject& AugmentaObject);
+};
+
+/**
+ * Keeps a pool of pre-spawned actors and assigns one to each Augmenta object of an Augmenta Event Dispatcher.
+ * Actors are activated when an object enters and deactivated when it leaves, instead of being spawned and destroyed.
+ * Actor transforms are relative to the pool, so it should be placed where the Augmenta scene is.
+ */
+UCLASS(BlueprintType, Category = "Augmenta")
+class LIVELINKAUGMENTA_API ALiveLinkAugmentaActorPool : public AActor
+{
+	GENERATED_BODY()
+
+public:
+
+	// Sets default values for this actor's properties
+	ALiveLinkAugmentaActorPool();
+
+protected:
+	// Called when the game starts or when spawned
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	// Augmenta Event Dispatcher providing the Augmenta objects
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Actor Pool")
+	ALiveLinkAugmentaEventDispatcher* AugmentaEventDispatcher;
+
+	// Class of the pooled actors. It can implement the AugmentaPooledActor interface to be notified.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Actor Pool")
+	TSubclassOf<AActor> PooledActorClass;
+
+	// Number of actors spawned when the game starts
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Actor Pool", meta = (ClampMin = "0"))
+	int PoolSize = 32;
+
+	// Spawn a new actor when the pool is empty. Otherwise the objects entering are ignored until an actor is freed.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Actor Pool")
+	bool bGrowPool = true;
+
+	// Move the actors to the position and rotation of their object.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Actor Pool")
+	bool bUpdateActorTransforms = true;
+
+	// Number of objects that got an actor from the pool
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Actor Pool|Stats")
+	int PoolHits = 0;
+
+	// Number of objects that found the pool empty
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Actor Pool|Stats")
+	int PoolMisses = 0;
+
+	// Get the number of actors currently representing an object
+	UFUNCTION(BlueprintPure, Category = "Augmenta|Actor Pool|Stats")
+	int GetActiveActorCount() const { return ActiveActors.Num(); }
+
+	// Get the number of actors waiting in the pool
+	UFUNCTION(BlueprintPure, Category = "Augmenta|Actor Pool|Stats")
+	int GetInactiveActorCount() const { return InactiveActors.Num(); }
+
+	/**
+	*  Get the actor representing an Augmenta object
+	*  @param  Id			The Id of the Augmenta object
+	*  @return The actor, null if the object has no actor
+	*/
+	UFUNCTION(BlueprintPure, Category = "Augmenta|Actor Pool")
+	AActor* GetActorForAugmentaObject(int Id) const;
+
+private:
+
+	void OnAugmentaObjectEntered(const FLiveLinkAugmentaObject& AugmentaObject);
+	void OnAugmentaObjectUpdated(const FLiveLinkAugmentaObject& AugmentaObject);
+	void OnAugmentaObjectLeft(const FLiveLinkAugmentaObject& AugmentaObject);
+	void OnAugmentaSourceDestroyed();
+
+	AActor* SpawnPooledActor();
+
+	void ActivateActor(AActor* Actor, const FLiveLinkAugmentaObject& AugmentaObject);
+	void DeactivateActor(AActor* Actor, const FLiveLinkAugmentaObject& AugmentaObject);
+
+	void UpdateActorTransform(AActor* Actor, const FLiveLinkAugmentaObject& AugmentaObject) const;
+
+	// Object Id -> active actor
+	UPROPERTY(Transient)
+	TMap<int, AActor*> ActiveActors;
+
+	UPROPERTY(Transient)
+	TArray<AActor*> InactiveActors;
+
+	// Dispatcher we are currently bound to
+	TWeakObjectPtr<ALiveLinkAugmentaEventDispatcher> BoundDispatcher;
+};
@@ -0,0 +1,182 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkAugmentaData.h"
+
+// Fields of an Augmenta object in the compact cluster wire format
+enum class EAugmentaClusterObjectFields : uint16
+{
+	None = 0,
+	Position = 1 << 0,
+	Rotation = 1 << 1,
+	Scale = 1 << 2,
+	Age = 1 << 3,
+	Frame = 1 << 4,
+	Oid = 1 << 5,
+	Centroid = 1 << 6,
+	Velocity = 1 << 7,
+	Orientation = 1 << 8,
+	BoundingRect = 1 << 9,
+	Height = 1 << 10,
+	Highest = 1 << 11,
+	Distance = 1 << 12,
+	Reflectivity = 1 << 13,
+	LastUpdateTime = 1 << 14,
+
+	// Fields sent when bSendReducedObjectData is set, the Oid names the Live Link subjects of the objects
+	Reduced = Position | Rotation | Scale | Age | Oid,
+	All = (1 << 15) - 1
+};
+ENUM_CLASS_FLAGS(EAugmentaClusterObjectFields);
+
+/**
+ * Appends values to a buffer in little endian order, whatever the endianness of the host.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaClusterWriter
+{
+public:
+
+	explicit FLiveLinkAugmentaClusterWriter(TArray<uint8>& InBuffer) : Buffer(InBuffer) { }
+
+	void WriteUInt8(uint8 Value) { Buffer.Add(Value); }
+	void WriteUInt16(uint16 Value);
+	void WriteUInt32(uint32 Value);
+	void WriteUInt64(uint64 Value);
+	void WriteFloat(float Value);
+
+	// Write an unsigned integer in 1 to 5 bytes, 7 bits per byte
+	void WriteVarUInt(uint32 Value);
+
+	// Write a signed integer as a zigzag encoded varint, so small negative values stay small
+	void WriteVarInt(int32 Value);
+
+	void WriteBytes(const uint8* Bytes, int32 Count) { Buffer.Append(Bytes, Count); }
+
+	TArray<uint8>& GetBuffer() { return Buffer; }
+
+private:
+
+	TArray<uint8>& Buffer;
+};
+
+/**
+ * Reads values written by FLiveLinkAugmentaClusterWriter.
+ * Reading past the end of the data returns zeros and sets the error flag, so a whole payload can be read before checking it once.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaClusterReader
+{
+public:
+
+	FLiveLinkAugmentaClusterReader(const uint8* InData, int32 InNum) : Data(InData), Num(InNum) { }
+
+	explicit FLiveLinkAugmentaClusterReader(const TArray<uint8>& InBuffer) : Data(InBuffer.GetData()), Num(InBuffer.Num()) { }
+
+	uint8 ReadUInt8();
+	uint16 ReadUInt16();
+	uint32 ReadUInt32();
+	uint64 ReadUInt64();
+	float ReadFloat();
+	uint32 ReadVarUInt();
+	int32 ReadVarInt();
+
+	// Get a pointer to the next bytes and skip them, nullptr if there are not enough bytes
+	const uint8* ReadBytes(int32 Count);
+
+	bool HasError() const { return bError; }
+
+	void SetError() { bError = true; }
+
+	bool IsAtEnd() const { return Offset == Num; }
+
+private:
+
+	bool CanRead(int32 Size);
+
+	const uint8* Data;
+	int32 Num;
+	int32 Offset = 0;
+	bool bError = false;
+};
+
+/**
+ * Range used to quantize the object positions to 16 bits, relative to the Augmenta scene.
+ */
+struct LIVELINKAUGMENTA_API FLiveLinkAugmentaClusterQuantization
+{
+	// Center of the quantized range
+	FVector Origin = FVector::ZeroVector;
+
+	// Half size of the quantized range along each axis (in Unreal units)
+	FVector HalfRange = FVector(DefaultHalfRange);
+
+	static constexpr float DefaultHalfRange = 5000.0f;
+
+	// Height range of the objects (in Unreal units)
+	static constexpr float HeightHalfRange = 1000.0f;
+
+	// Range covering the scene and up to half the scene size outside of it
+	static FLiveLinkAugmentaClusterQuantization FromScene(const FLiveLinkAugmentaScene& AugmentaScene);
+
+	int16 Quantize(double Value, int32 Axis) const;
+	double Dequantize(int16 Value, int32 Axis) const;
+};
+
+/**
+ * Compact versioned binary format of the Augmenta data replicated through the cluster.
+ * Positions are 16 bit fixed point values in the scene range, rotations a single 16 bit yaw angle (Augmenta objects only rotate around Z),
+ * scales half floats, Ids and counts varints. All values are little endian.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaClusterCodec
+{
+public:
+
+	// Increment when the format changes, payloads of another version are rejected
+	static constexpr uint8 FormatVersion = 1;
+
+	static EAugmentaClusterObjectFields GetObjectFields(bool bReducedData) { return bReducedData ? EAugmentaClusterObjectFields::Reduced : EAugmentaClusterObjectFields::All; }
+
+	static void WriteVersion(FLiveLinkAugmentaClusterWriter& Writer) { Writer.WriteUInt8(FormatVersion); }
+
+	// Read the version and set the reader error if it does not match
+	static bool ReadVersion(FLiveLinkAugmentaClusterReader& Reader);
+
+	static void WriteQuantization(FLiveLinkAugmentaClusterWriter& Writer, const FLiveLinkAugmentaClusterQuantization& Quantization);
+	static void ReadQuantization(FLiveLinkAugmentaClusterReader& Reader, FLiveLinkAugmentaClusterQuantization& Quantization);
+
+	static void WriteScene(FLiveLinkAugmentaClusterWriter& Writer, const FLiveLinkAugmentaScene& AugmentaScene);
+	static void ReadScene(FLiveLinkAugmentaClusterReader& Reader, FLiveLinkAugmentaScene& AugmentaScene);
+
+	static void WriteVideoOutput(FLiveLinkAugmentaClusterWriter& Writer, const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
+	static void ReadVideoOutput(FLiveLinkAugmentaClusterReader& Reader, FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
+
+	/**
+	*  Write an object, preceded by its Id and field mask
+	*  @param  Writer				The writer to append to
+	*  @param  AugmentaObject		The object to write
+	*  @param  Fields				The fields to write
+	*  @param  Quantization		The position range
+	*/
+	static void WriteObject(FLiveLinkAugmentaClusterWriter& Writer, const FLiveLinkAugmentaObject& AugmentaObject, EAugmentaClusterObjectFields Fields, const FLiveLinkAugmentaClusterQuantization& Quantization);
+
+	/**
+	*  Read an object written by WriteObject. Fields absent from the payload keep their value.
+	*  @return The fields read
+	*/
+	static EAugmentaClusterObjectFields ReadObject(FLiveLinkAugmentaClusterReader& Reader, FLiveLinkAugmentaObject& AugmentaObject, const FLiveLinkAugmentaClusterQuantization& Quantization);
+
+	// Read the Id of an object written by WriteObject, to be followed by ReadObjectFields.
+	// Lets the reader start from a previous state of the object when only some fields were written.
+	static int32 ReadObjectId(FLiveLinkAugmentaClusterReader& Reader) { return Reader.ReadVarInt(); }
+
+	static EAugmentaClusterObjectFields ReadObjectFields(FLiveLinkAugmentaClusterReader& Reader, FLiveLinkAugmentaObject& AugmentaObject, const FLiveLinkAugmentaClusterQuantization& Quantization);
+
+	// Fields whose encoded value differs between two states of an object
+	static EAugmentaClusterObjectFields GetChangedFields(const FLiveLinkAugmentaObject& Previous, const FLiveLinkAugmentaObject& Current, const FLiveLinkAugmentaClusterQuantization& Quantization);
+
+	// Size in bytes of an object written by WriteObject, without encoding it
+	static int32 GetObjectSize(const FLiveLinkAugmentaObject& AugmentaObject, EAugmentaClusterObjectFields Fields);
+
+	static int32 GetVarUIntSize(uint32 Value);
+};
@@ -0,0 +1,43 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkAugmentaData.h"
+
+/**
+ * Json parameters of the Augmenta cluster events, described by static key tables.
+ * Keeps the keys and value formats of the original json events so that nodes running older versions still understand them.
+ * Decoding looks each received key up once and tolerates missing or unknown keys, which keep their default value.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaClusterJsonCodec
+{
+public:
+
+	static void WriteScene(const FLiveLinkAugmentaScene& AugmentaScene, TMap<FString, FString>& EventData);
+
+	// @return FALSE if some fields were missing
+	static bool ReadScene(const TMap<FString, FString>& EventData, FLiveLinkAugmentaScene& AugmentaScene);
+
+	static void WriteVideoOutput(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput, TMap<FString, FString>& EventData);
+
+	// @return FALSE if some fields were missing
+	static bool ReadVideoOutput(const TMap<FString, FString>& EventData, FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
+
+	/**
+	*  Write the json parameters of an object
+	*  @param  AugmentaObject		The object to write
+	*  @param  bReducedData		Only write the transform, id, oid and age
+	*  @param  EventData			The parameters, emptied first
+	*/
+	static void WriteObject(const FLiveLinkAugmentaObject& AugmentaObject, bool bReducedData, TMap<FString, FString>& EventData);
+
+	// @return FALSE if some fields of the reduced data were missing. The other fields are optional.
+	static bool ReadObject(const TMap<FString, FString>& EventData, FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Same output as FString::SanitizeFloat (6 decimals, trailing zeros removed) built in a single allocation
+	static FString FormatFloat(double Value);
+
+	// Parse a decimal number without exponent exactly, falls back to FCString::Atod for anything else
+	static double ParseFloat(const TCHAR* Value);
+};
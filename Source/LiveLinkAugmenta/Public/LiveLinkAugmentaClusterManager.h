@@ -4,6 +4,10 @@
 
 #include "LiveLinkAugmenta.h"
 #include "LiveLinkAugmentaData.h"
+#include "LiveLinkAugmentaClusterCodec.h"
+#include "LiveLinkAugmentaClusterSyncObject.h"
+#include "LiveLinkAugmentaFrameBuffer.h"
+#include "LiveLinkAugmentaClusterSource.h"
 
 #include "Cluster/IDisplayClusterClusterEventListener.h"
 
@@ -15,6 +19,33 @@
 
 /** Forward Declarations */
 class IDisplayClusterClusterManager;
+class ALiveLinkAugmentaManager;
+
+UENUM(BlueprintType)
+enum class EAugmentaClusterReplicationMode : uint8
+{
+	// One cluster event per Augmenta event
+	PerEvent,
+	// One binary cluster event per frame carrying the scene, video output and all entered, updated and left objects. Requires binary cluster events.
+	// The events received between two frames are coalesced: enters and leaves are always sent, updates only carry the latest state of each object.
+	BatchedFrame,
+	// An nDisplay sync object carrying a compact snapshot of the primary node state, applied on all nodes at the same frame.
+	// Nodes compute the entered, updated and left objects from the difference with their current state.
+	SyncObject,
+	// Every node receives the Augmenta stream with its own Live Link source, through a multicast group, and buffers its last frames.
+	// The primary node only replicates the number of the frame to apply. Requires an Augmenta Manager with frame buffering enabled
+	// in its source settings as Augmenta Event Dispatcher, and binary cluster events.
+	LocalIngest
+};
+
+UENUM(BlueprintType)
+enum class EAugmentaClusterWireFormat : uint8
+{
+	// Memory copy of the Augmenta structures. Only safe between nodes of the same platform and build.
+	Raw,
+	// Versioned little endian format with quantized transforms and varint ids. See FLiveLinkAugmentaClusterCodec.
+	Compact
+};
 
 UCLASS(BlueprintType, Category = "Augmenta")
 class LIVELINKAUGMENTA_API ALiveLinkAugmentaClusterManager : public ALiveLinkAugmentaEventDispatcher, public IDisplayClusterClusterEventListener
@@ -37,10 +68,96 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Cluster Events")
 	int BinaryEventIdOffset;
 
-	//Send only the transform, id and age data of the Augmenta objects to improve performance. Only works with json cluster events.
+	//Send only the transform, id, oid and age data of the Augmenta objects to improve performance. Works with json and compact binary cluster events.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Cluster Events")
 	bool bSendReducedObjectData;
 
+	//How Augmenta events are replicated to the cluster.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events")
+	EAugmentaClusterReplicationMode ReplicationMode;
+
+	//Format of the binary cluster events. All the nodes of the cluster must use the same format.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events", meta = (EditCondition = "bUseBinaryClusterEvents"))
+	EAugmentaClusterWireFormat WireFormat;
+
+	//With per event replication, decode the cluster events received during a frame and dispatch them once in Tick, as one frame.
+	//Updates of the same object are coalesced. Otherwise each cluster event is dispatched when received.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events")
+	bool bBatchReceivedEvents;
+
+	//Only send the object fields that changed since the last frame. Requires batched frame replication and the compact wire format.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events")
+	bool bUseDeltaCompression;
+
+	//Number of frames between two keyframes carrying the full state of every object, so that joining or out of sync nodes recover.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events", meta = (ClampMin = "1", EditCondition = "bUseDeltaCompression"))
+	int KeyframeInterval;
+
+	//Only dispatch on each node the objects inside the footprint of its viewports on the Augmenta scene plane.
+	//Requires batched frame replication and the compact wire format, and disables delta compression.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Interest Management")
+	bool bUseInterestManagement;
+
+	//Distance (in Unreal units) around the footprint of a node within which objects are still dispatched on this node.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Interest Management", meta = (ClampMin = "0.0", EditCondition = "bUseInterestManagement"))
+	float InterestMargin;
+
+	//Actor placing the Augmenta scene in the world. The scene is at the world origin if not set.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Interest Management", meta = (EditCondition = "bUseInterestManagement"))
+	AActor* InterestSceneOrigin;
+
+	//Use InterestRegionOverride as the footprint of this node instead of computing it from its viewports.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Interest Management", meta = (EditCondition = "bUseInterestManagement"))
+	bool bUseInterestRegionOverride;
+
+	//Footprint of this node on the Augmenta scene plane, in the same space as the objects Position.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Interest Management", meta = (EditCondition = "bUseInterestManagement && bUseInterestRegionOverride"))
+	FBox2D InterestRegionOverride;
+
+	//Create a Live Link source on this node fed by the replicated data, so that every node evaluates identical Live Link subjects without opening a socket.
+	//Object subjects are named by Oid, which is part of the reduced object data. With interest management, a node only has subjects for the objects in its interest region.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Live Link")
+	bool bCreateClusterLiveLinkSource;
+
+	//Scene name of the subjects of the cluster Live Link source. Use a different name than the Augmenta sources, or disable their subjects update, to avoid conflicting subjects.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Live Link", meta = (EditCondition = "bCreateClusterLiveLinkSource"))
+	FName ClusterLiveLinkSceneName;
+
+	//Number of frames the primary node waits after receiving a frame before selecting it with local ingest, so that the other nodes received it too.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events", meta = (ClampMin = "0", ClampMax = "15"))
+	int FrameSelectionDelay;
+
+	//Number of frames selected by the primary node that this node never received or no longer buffered, with local ingest.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events|Stats")
+	int MissedFrameCount = 0;
+
+	//Size in bytes of the last frame sent with delta compression, or of the last snapshot published with sync object replication.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events|Stats")
+	int LastFrameBytes = 0;
+
+	//Size in bytes the last frame would have had without delta compression.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events|Stats")
+	int LastFrameFullBytes = 0;
+
+	//Average number of bytes saved per frame by delta compression, keyframes included.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events|Stats")
+	float AverageBytesSavedPerFrame = 0;
+
+	//Number of object updates replaced by a later state of the same object before being sent, with batched frame replication.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events|Stats")
+	int CoalescedUpdateCount = 0;
+
+	//Number of object updates coalesced in the last frame sent.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events|Stats")
+	int LastFrameCoalescedUpdates = 0;
+
+	//Number of scene and video output updates replaced by a later one before being sent, with batched frame replication.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Cluster Events|Stats")
+	int CoalescedSceneUpdateCount = 0;
+
+	// Called every frame
+	virtual void Tick(float DeltaTime) override;
+
 protected:
 
 	bool bInitialized;
@@ -51,19 +168,19 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UFUNCTION(BlueprintCallable, Category = "Augmenta|Cluster")
-	void SendSceneUpdatedClusterEvent(const FLiveLinkAugmentaScene AugmentaScene);
+	void SendSceneUpdatedClusterEvent(const FLiveLinkAugmentaScene& AugmentaScene);
 
 	UFUNCTION(BlueprintCallable, Category = "Augmenta|Cluster")
-	void SendVideoOutputUpdatedClusterEvent(const FLiveLinkAugmentaVideoOutput AugmentaVideoOutput);
+	void SendVideoOutputUpdatedClusterEvent(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
 
 	UFUNCTION(BlueprintCallable, Category = "Augmenta|Cluster")
-	void SendObjectEnteredClusterEvent(const FLiveLinkAugmentaObject AugmentaObject);
+	void SendObjectEnteredClusterEvent(const FLiveLinkAugmentaObject& AugmentaObject);
 
 	UFUNCTION(BlueprintCallable, Category = "Augmenta|Cluster")
-	void SendObjectUpdatedClusterEvent(const FLiveLinkAugmentaObject AugmentaObject);
+	void SendObjectUpdatedClusterEvent(const FLiveLinkAugmentaObject& AugmentaObject);
 
 	UFUNCTION(BlueprintCallable, Category = "Augmenta|Cluster")
-	void SendObjectLeftClusterEvent(const FLiveLinkAugmentaObject AugmentaObject);
+	void SendObjectLeftClusterEvent(const FLiveLinkAugmentaObject& AugmentaObject);
 
 	UFUNCTION(BlueprintCallable, Category = "Augmenta|Cluster")
 	void SendSourceDestroyedClusterEvent();
@@ -77,14 +194,33 @@ protected:
 	TMap<FString, FString> SerializeJsonAugmentaObject(const FLiveLinkAugmentaObject AugmentaObject);
 	FLiveLinkAugmentaObject DeserializeJsonAugmentaObject(const TMap<FString, FString> EventData);
 
+	// Binary deserializers return false when the event data is malformed or of another format version
 	TArray<uint8> SerializeBinaryAugmentaScene(const FLiveLinkAugmentaScene AugmentaScene);
-	FLiveLinkAugmentaScene DeserializeBinaryAugmentaScene(const TArray<uint8> EventData);
+	bool DeserializeBinaryAugmentaScene(const TArray<uint8>& EventData, FLiveLinkAugmentaScene& AugmentaScene);
 
 	TArray<uint8> SerializeBinaryAugmentaVideoOutput(const FLiveLinkAugmentaVideoOutput AugmentaVideoOutput);
-	FLiveLinkAugmentaVideoOutput DeserializeBinaryAugmentaVideoOutput(const TArray<uint8> EventData);
+	bool DeserializeBinaryAugmentaVideoOutput(const TArray<uint8>& EventData, FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
 
 	TArray<uint8> SerializeBinaryAugmentaObject(const FLiveLinkAugmentaObject AugmentaObject);
-	FLiveLinkAugmentaObject DeserializeBinaryAugmentaObject(const TArray<uint8> EventData);
+	bool DeserializeBinaryAugmentaObject(const TArray<uint8>& EventData, FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Serialize the pending events of the frame. A keyframe also carries the full state of every object sent before.
+	void SerializeBinaryAugmentaFrame(TArray<uint8>& EventData, bool bKeyframe);
+
+	// Decode a whole frame in one pass and broadcast its events
+	void ApplyBinaryAugmentaFrame(const TArray<uint8>& EventData);
+
+	// Broadcast the received objects, and the scene and video output if not null
+	void BroadcastReceivedFrame(const FLiveLinkAugmentaScene* AugmentaScene, const FLiveLinkAugmentaVideoOutput* AugmentaVideoOutput);
+
+	// Serialize the scene, video output and tracked objects of the Augmenta Event Dispatcher
+	void SerializeAugmentaSnapshot(TArray<uint8>& OutSnapshotData);
+
+	// Decode a snapshot and broadcast its difference with the objects tracked by this node
+	void ApplyAugmentaSnapshot(const FString& Snapshot);
+
+	// Range of the quantized object positions in the compact format, follows the last scene sent
+	FLiveLinkAugmentaClusterQuantization Quantization;
 
 	IDisplayClusterClusterManager* ClusterManager;
 
@@ -96,4 +232,190 @@ public:
 	UFUNCTION(BlueprintNativeEvent)
 	void OnClusterEventBinary(const FDisplayClusterClusterEventBinary& Event);
 
+private:
+
+	// Accumulate the events of the frame in batched mode
+	void OnAugmentaSceneUpdated(const FLiveLinkAugmentaScene& AugmentaScene);
+	void OnAugmentaVideoOutputUpdated(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
+	void OnAugmentaFrame(const TArray<FLiveLinkAugmentaObject>& EnteredObjects, const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects);
+
+	// Send the accumulated events as one cluster event
+	void SendFrameClusterEvent(bool bKeyframe);
+
+	bool IsDeltaCompressionActive() const;
+
+	void ResetPendingFrame();
+
+	// Fill the pending object arrays from the coalesced object events
+	void BuildPendingFrame();
+
+	// Split coalesced object events into entered, updated and left objects. An object entering and updated during the frame is both entered and updated.
+	// The lifecycles of the objects coming back after leaving are deferred to the next frame, so that the leave and enter events are both delivered.
+	void SplitCoalescedEvents(const FLiveLinkAugmentaEventCoalescer& Events, TArray<FLiveLinkAugmentaObject>& EnteredObjects,
+		TArray<FLiveLinkAugmentaObject>& UpdatedObjects, TArray<FLiveLinkAugmentaObject>& LeftObjects, TArray<FAugmentaCoalescedEvent>& DeferredEvents);
+
+	// Object events received since the last frame sent in batched mode, one slot per object lifecycle
+	FLiveLinkAugmentaEventCoalescer PendingEvents;
+	int PendingUpdateEventCount = 0;
+
+	// Lifecycles of the objects that came back after leaving, sent with the next frame
+	TArray<FAugmentaCoalescedEvent> DeferredPendingEvents;
+
+	// Ids of the left objects, to detect the objects coming back in the same frame
+	TSet<int> CoalescedLeftIds;
+
+	// Dispatch a decoded per event cluster event, or accumulate it until the next Tick when batching received events
+	void ReceiveSceneUpdated(const FLiveLinkAugmentaScene& AugmentaScene);
+	void ReceiveVideoOutputUpdated(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
+	void ReceiveObjectEvent(int EventType, const FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Dispatch the per event cluster events received since the last Tick as one frame
+	void FlushReceivedEvents();
+
+	// Per event cluster events received during the frame, reused between frames
+	bool bIsBatchingReceivedEvents = false;
+	FLiveLinkAugmentaEventCoalescer ReceivedEvents;
+	TArray<FAugmentaCoalescedEvent> DeferredReceivedEvents;
+	bool bHasReceivedScene = false;
+	FLiveLinkAugmentaScene ReceivedScene;
+	bool bHasReceivedVideoOutput = false;
+	FLiveLinkAugmentaVideoOutput ReceivedVideoOutput;
+	FLiveLinkAugmentaObject ReceivedObject;
+
+	// Events of the frame to send in batched mode, sent in Tick after the dispatcher ticked
+	bool bHasPendingScene = false;
+	FLiveLinkAugmentaScene PendingScene;
+	bool bHasPendingVideoOutput = false;
+	FLiveLinkAugmentaVideoOutput PendingVideoOutput;
+	TArray<FLiveLinkAugmentaObject> PendingEnteredObjects;
+	TArray<FLiveLinkAugmentaObject> PendingUpdatedObjects;
+	TArray<FLiveLinkAugmentaObject> PendingLeftObjects;
+
+	// Publish the snapshot of the primary node, apply the snapshot synchronized at the start of the frame
+	void TickSyncObject();
+
+	// Sync object replication state
+	TUniquePtr<FLiveLinkAugmentaClusterSyncObject> SyncObject;
+	bool bIsPrimary = false;
+	bool bSnapshotChanged = false;
+
+	// Snapshot published at the last tick, applied by every node at the next one
+	FString PublishedSnapshot;
+	bool bHasPublishedSnapshot = false;
+
+	// Revisions tell the nodes which parts of the snapshot changed since the last one they applied
+	uint32 SceneRevision = 0;
+	uint32 VideoOutputRevision = 0;
+	uint32 SourceDestroyedRevision = 0;
+	uint32 AppliedSceneRevision = 0;
+	uint32 AppliedVideoOutputRevision = 0;
+	uint32 AppliedSourceDestroyedRevision = 0;
+
+	FLiveLinkAugmentaScene SnapshotScene;
+	FLiveLinkAugmentaVideoOutput SnapshotVideoOutput;
+
+	// Snapshot buffers, reused between frames
+	TArray<uint8> SnapshotData;
+	TArray<FLiveLinkAugmentaObject> ReceivedSnapshotObjects;
+
+	// Select the frame to apply on the primary node, retry applying a selected frame not received yet
+	void TickLocalIngest();
+
+	// Apply the selected frame from the frame buffer of the local source
+	void ApplyIngestFrame();
+
+	// Local ingest state
+	ALiveLinkAugmentaManager* IngestManager = nullptr;
+	bool bHasSelectedIngestFrame = false;
+	int32 SelectedIngestFrame = 0;
+	bool bHasPendingIngestFrame = false;
+	int32 PendingIngestFrame = 0;
+	uint32 AppliedIngestVideoOutputRevision = 0;
+	bool bHasWarnedFrameBuffering = false;
+
+	// Frame read from the frame buffer, reused between frames
+	FLiveLinkAugmentaBufferedFrame IngestFrame;
+
+	// Fill the received entered, updated and left objects with the difference between a full state and the tracked objects
+	void DiffReceivedObjects(const TArray<FLiveLinkAugmentaObject>& AugmentaObjects, const FLiveLinkAugmentaClusterQuantization& ObjectQuantization);
+
+	// Interest management
+	bool IsInterestManagementActive() const;
+
+	// Compute the footprint of this node and send it to the primary node when it changed
+	void UpdateInterestRegion();
+
+	// Footprint of the viewports of this node on the Augmenta scene plane, FALSE if a viewport sees above the horizon
+	bool ComputeInterestRegion(FBox2D& OutRegion) const;
+
+	void OnInterestRegionReceived(const TArray<uint8>& EventData);
+
+	// Write the objects of the pending frame, one chunk per node with its own entered, updated and left objects
+	void WriteInterestChunks(FLiveLinkAugmentaClusterWriter& Writer, EAugmentaClusterObjectFields Fields);
+
+	void WriteInterestChunk(FLiveLinkAugmentaClusterWriter& Writer, const FString& NodeId, const TArray<FLiveLinkAugmentaObject>& EnteredObjects,
+		const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects, EAugmentaClusterObjectFields Fields);
+
+	struct FInterestRegion
+	{
+		// Footprint of the node expanded by the interest margin
+		FBox2D Region;
+
+		// Objects the node was told entered and not left yet
+		TSet<int> ObjectIds;
+
+		// Whether the node read the default chunk until now, its known objects are seeded from the next frame
+		bool bIsNew = true;
+
+		// Whether the region changed since the last frame, objects that did not move enter or leave the node with the next frame
+		bool bNeedsSync = true;
+	};
+
+	// Footprint of each node, on the primary node. Key is the node id.
+	TMap<FString, FInterestRegion> InterestRegions;
+
+	FString LocalNodeId;
+	bool bHasSentInterestRegion = false;
+	bool bSentInterestRegionValid = false;
+	FBox2D SentInterestRegion;
+	double LastInterestRegionUpdateTime = 0;
+
+	// Interest chunk buffers, reused between frames
+	TArray<uint8> InterestChunkData;
+	TArray<FLiveLinkAugmentaObject> InterestEnteredObjects;
+	TArray<FLiveLinkAugmentaObject> InterestUpdatedObjects;
+	TArray<FLiveLinkAugmentaObject> InterestLeftObjects;
+	TSet<int> InterestFrameObjectIds;
+	TArray<FString> ClusterNodeIds;
+
+	// Live Link source fed by the replicated data
+	TSharedPtr<FLiveLinkAugmentaClusterSource> ClusterLiveLinkSource;
+	FGuid ClusterLiveLinkSourceGuid;
+
+	void CreateClusterLiveLinkSource();
+	void RemoveClusterLiveLinkSource();
+
+	// Last state sent of each object, the reference of delta compression
+	TMap<int, FLiveLinkAugmentaObject> LastSentStates;
+
+	// Last scene and video output sent, repeated in keyframes
+	bool bHasLastSentScene = false;
+	FLiveLinkAugmentaScene LastSentScene;
+	bool bHasLastSentVideoOutput = false;
+	FLiveLinkAugmentaVideoOutput LastSentVideoOutput;
+
+	int FramesSinceKeyframe = 0;
+	int64 TotalBytesSaved = 0;
+	int64 DeltaFrameCount = 0;
+
+	// Objects of a keyframe without events this frame, reused between keyframes
+	TSet<int> KeyframeObjectIds;
+	TArray<const FLiveLinkAugmentaObject*> KeyframeObjects;
+
+	// Objects of a received frame, reused between frames
+	TArray<FLiveLinkAugmentaObject> ReceivedEnteredObjects;
+	TArray<FLiveLinkAugmentaObject> ReceivedUpdatedObjects;
+	TArray<FLiveLinkAugmentaObject> ReceivedLeftObjects;
+	TArray<FLiveLinkAugmentaObject> ReceivedKeyframeObjects;
+	TSet<int> ReceivedKeyframeIds;
 };
@@ -0,0 +1,55 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "ILiveLinkSource.h"
+#include "LiveLinkAugmentaData.h"
+#include "LiveLinkAugmentaSubjectPusher.h"
+
+/** Forward Declarations */
+class ALiveLinkAugmentaEventDispatcher;
+
+/**
+ * Virtual Augmenta Live Link source fed by the events of an Augmenta Cluster Manager instead of a socket.
+ * Creates the same subjects as an Augmenta source from the replicated data, so that every nDisplay node evaluates identical subjects.
+ * Lives on the game thread.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaClusterSource : public ILiveLinkSource, public TSharedFromThis<FLiveLinkAugmentaClusterSource>
+{
+public:
+
+	explicit FLiveLinkAugmentaClusterSource(FName InSceneName);
+
+	// Begin ILiveLinkSource Interface
+
+	virtual void ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid) override;
+
+	virtual bool IsSourceStillValid() const override { return !bIsShutdown; }
+
+	virtual bool RequestSourceShutdown() override;
+
+	virtual FText GetSourceType() const override;
+	virtual FText GetSourceMachineName() const override;
+	virtual FText GetSourceStatus() const override;
+
+	// End ILiveLinkSource Interface
+
+	// Push the events of an Augmenta Event Dispatcher to the subjects
+	void Attach(ALiveLinkAugmentaEventDispatcher* EventDispatcher);
+
+	void Detach(ALiveLinkAugmentaEventDispatcher* EventDispatcher);
+
+private:
+
+	void OnAugmentaSceneUpdated(const FLiveLinkAugmentaScene& AugmentaScene);
+	void OnAugmentaVideoOutputUpdated(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
+	void OnAugmentaObjectUpdated(const FLiveLinkAugmentaObject& AugmentaObject);
+	void OnAugmentaObjectLeft(const FLiveLinkAugmentaObject& AugmentaObject);
+	void OnAugmentaSourceDestroyed();
+
+	FName SceneName;
+
+	bool bIsShutdown = false;
+
+	FLiveLinkAugmentaSubjectPusher SubjectPusher;
+};
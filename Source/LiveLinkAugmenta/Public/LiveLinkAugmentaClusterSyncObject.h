@@ -0,0 +1,45 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Cluster/IDisplayClusterClusterSyncObject.h"
+
+/**
+ * nDisplay sync object carrying the Augmenta snapshot of the primary node as a string.
+ * The snapshot is set and consumed on the game thread, while nDisplay may serialize it from its own threads.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaClusterSyncObject : public IDisplayClusterClusterSyncObject
+{
+public:
+
+	explicit FLiveLinkAugmentaClusterSyncObject(const FString& InSyncId) : SyncId(InSyncId) { }
+
+	// Set the snapshot to send to the other nodes at the next synchronization
+	void SetSnapshot(const FString& InSnapshot);
+
+	// Get the snapshot received at the last synchronization
+	// @return FALSE if no new snapshot was received since the last call
+	bool ConsumeSnapshot(FString& OutSnapshot);
+
+	//~ Begin IDisplayClusterClusterSyncObject interface
+	virtual bool IsActive() const override { return true; }
+	virtual FString GetSyncId() const override { return SyncId; }
+	virtual bool IsDirty() const override;
+	virtual void ClearDirty() override;
+	virtual FString SerializeToString() const override;
+	virtual bool DeserializeFromString(const FString& Data) override;
+	//~ End IDisplayClusterClusterSyncObject interface
+
+private:
+
+	const FString SyncId;
+
+	mutable FCriticalSection SnapshotLock;
+
+	FString Snapshot;
+
+	bool bIsDirty = false;
+
+	bool bIsReceived = false;
+};
@@ -10,7 +10,7 @@ struct LIVELINKAUGMENTA_API FLiveLinkAugmentaConnectionSettings
 {
 	GENERATED_BODY()
 
-	/** IP address of the receiving UDP socket. */
+	/** IP address of the receiving UDP socket. A multicast address joins the multicast group, to receive the same stream on several nDisplay nodes. */
 	UPROPERTY(EditAnywhere, Category = "Connection Settings")
 	FString IPAddress = TEXT("0.0.0.0");
 
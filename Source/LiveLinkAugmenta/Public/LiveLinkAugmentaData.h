@@ -155,3 +155,26 @@ struct LIVELINKAUGMENTA_API FLiveLinkAugmentaVideoOutput
 	UPROPERTY(BlueprintReadWrite, Category = "Augmenta|VideoOutput|Transform")
 	FVector Scale = FVector::ZeroVector;
 };
+
+// Structure used to transfer Augmenta events from the receiving thread to the consumers
+USTRUCT(BlueprintType) //BlueprintType to get access in BP
+struct FAugmentaEventData
+{
+	GENERATED_USTRUCT_BODY()
+
+	//Those are copied through the source event ring without being UPROPERTY() references
+	//so do not store UE Actor or UE Object pointers in this struct!
+	//The ring copies slots while they may be overwritten, so this struct must stay trivially copyable:
+	//plain values only (FDateTime is a tick count), no FString, TArray or other owning members.
+
+	// Id of the Augmenta object this event refers to. -1 = AugmentaScene, -2 = AugmentaVideoOutput
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Event Data")
+	int ObjectId = 0;
+
+	// Type of event : 0 = SceneUpdate, 1 = VideoOutputUpdate, 2 = ObjectEnter, 3 = ObjectUpdate, 4 = ObjectLeave
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Event Data")
+	int EventType = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Event Data")
+	FLiveLinkAugmentaObject AugmentaObject;
+};
@@ -0,0 +1,80 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkAugmentaData.h"
+
+// Lifecycle steps recorded for an object since the last reset
+enum class EAugmentaLifecycleFlags : uint8
+{
+	None = 0,
+	Entered = 1 << 0,
+	Updated = 1 << 1,
+	Left = 1 << 2
+};
+ENUM_CLASS_FLAGS(EAugmentaLifecycleFlags);
+
+// All the events received for one object since the last reset
+struct FAugmentaCoalescedEvent
+{
+	// Id of the Augmenta object. -1 = AugmentaScene, -2 = AugmentaVideoOutput
+	int ObjectId = 0;
+
+	EAugmentaLifecycleFlags Flags = EAugmentaLifecycleFlags::None;
+
+	// Latest state received for this object
+	FLiveLinkAugmentaObject AugmentaObject;
+
+	bool HasEntered() const { return EnumHasAnyFlags(Flags, EAugmentaLifecycleFlags::Entered); }
+	bool HasUpdated() const { return EnumHasAnyFlags(Flags, EAugmentaLifecycleFlags::Updated); }
+	bool HasLeft() const { return EnumHasAnyFlags(Flags, EAugmentaLifecycleFlags::Left); }
+};
+
+/**
+ * Coalesces Augmenta events per object Id in O(1) per event.
+ * Each object gets one slot recording its lifecycle steps in order (enter, update, leave) and its latest state,
+ * so an object entering and leaving during the same frame still produces both events.
+ * An object leaving then entering again gets a new slot so the order of the two lifecycles is kept.
+ * Reset keeps the allocated memory so steady state frames do not allocate.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaEventCoalescer
+{
+public:
+
+	/**
+	*  Record an event
+	*  @param  ObjectId			Id of the Augmenta object. -1 = AugmentaScene, -2 = AugmentaVideoOutput
+	*  @param  EventType			0 = SceneUpdate, 1 = VideoOutputUpdate, 2 = ObjectEnter, 3 = ObjectUpdate, 4 = ObjectLeave
+	*  @param  AugmentaObject		The object state carried by the event
+	*/
+	void Add(int ObjectId, int EventType, const FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Record a lifecycle taken from the events of a previous frame, before any other event of its object
+	void Add(const FAugmentaCoalescedEvent& Event);
+
+	// Coalesced events, in the order their objects were first seen
+	const TArray<FAugmentaCoalescedEvent>& GetEvents() const { return Events; }
+
+	int Num() const { return Events.Num(); }
+
+	// Whether an event was recorded for an object since the last reset
+	bool Contains(int ObjectId) const { return IdToEventIndex.Contains(ObjectId); }
+
+	// Current lifecycle recorded for an object, nullptr if none
+	const FAugmentaCoalescedEvent* Find(int ObjectId) const
+	{
+		const int32* EventIndex = IdToEventIndex.Find(ObjectId);
+		return EventIndex ? &Events[*EventIndex] : nullptr;
+	}
+
+	// Remove all events, keeping the allocated memory
+	void Reset();
+
+private:
+
+	TArray<FAugmentaCoalescedEvent> Events;
+
+	// Object Id -> index of its current slot in Events
+	TMap<int, int32> IdToEventIndex;
+};
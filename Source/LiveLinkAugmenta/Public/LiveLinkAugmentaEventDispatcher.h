@@ -3,6 +3,10 @@
 #pragma once
 
 #include "LiveLinkAugmentaData.h"
+#include "LiveLinkAugmentaEventCoalescer.h"
+#include "LiveLinkAugmentaSpatialIndex.h"
+#include "LiveLinkAugmentaSubscription.h"
+#include "LiveLinkAugmentaZoneEngine.h"
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
@@ -12,7 +16,20 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAugmentaSceneUpdatedEvent, const FLiveLinkAugmentaScene, AugmentaScene);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAugmentaObjectUpdatedEvent, const FLiveLinkAugmentaObject, AugmentaObject);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAugmentaVideoOutputUpdatedEvent, const FLiveLinkAugmentaVideoOutput, AugmentaVideoOutput);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FAugmentaFrameEvent, const TArray<FLiveLinkAugmentaObject>&, EnteredObjects, const TArray<FLiveLinkAugmentaObject>&, UpdatedObjects, const TArray<FLiveLinkAugmentaObject>&, LeftObjects);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FAugmentaSourceDestroyedEvent);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FAugmentaZoneObjectEvent, const FName, ZoneName, const int, ObjectId);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FAugmentaZoneOccupancyChangedEvent, const FName, ZoneName, const int, Occupancy);
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FAugmentaFilteredFrameEvent, const TArray<FLiveLinkAugmentaObject>&, EnteredObjects, const TArray<FLiveLinkAugmentaObject>&, UpdatedObjects, const TArray<FLiveLinkAugmentaObject>&, LeftObjects);
+
+/** Native delegates, for C++ listeners that do not need reflection */
+DECLARE_MULTICAST_DELEGATE_OneParam(FAugmentaSceneUpdatedNativeEvent, const FLiveLinkAugmentaScene&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FAugmentaObjectUpdatedNativeEvent, const FLiveLinkAugmentaObject&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FAugmentaVideoOutputUpdatedNativeEvent, const FLiveLinkAugmentaVideoOutput&);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FAugmentaFrameNativeEvent, const TArray<FLiveLinkAugmentaObject>&, const TArray<FLiveLinkAugmentaObject>&, const TArray<FLiveLinkAugmentaObject>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FAugmentaZoneNativeEvent, const FLiveLinkAugmentaZoneEvent&);
+DECLARE_MULTICAST_DELEGATE(FAugmentaSourceDestroyedNativeEvent);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FAugmentaObjectSubscriptionNativeEvent, const FLiveLinkAugmentaObject&, EAugmentaLifecycleFlags);
 
 UCLASS(BlueprintType, Category = "Augmenta")
 class LIVELINKAUGMENTA_API ALiveLinkAugmentaEventDispatcher : public AActor
@@ -24,6 +41,12 @@ public:
 	// Sets default values for this actor's properties
 	ALiveLinkAugmentaEventDispatcher();
 
+protected:
+	// Called when the game starts or when spawned
+	virtual void BeginPlay() override;
+
+public:
+
 	// A delegate that is fired when an Augmenta scene message is received.
 	UPROPERTY(BlueprintAssignable, Category = "Augmenta|Events")
 	FAugmentaSceneUpdatedEvent OnAugmentaSceneUpdated;
@@ -44,7 +67,207 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Augmenta|Events")
 	FAugmentaObjectUpdatedEvent OnAugmentaObjectLeft;
 
+	// A delegate that is fired once per frame with all the Augmenta objects that entered, were updated or left during the frame.
+	UPROPERTY(BlueprintAssignable, Category = "Augmenta|Events")
+	FAugmentaFrameEvent OnAugmentaFrame;
+
+	// Whether to fire OnAugmentaObjectEntered, OnAugmentaObjectUpdated and OnAugmentaObjectLeft for each object.
+	// Disable it when only OnAugmentaFrame is used to save one Blueprint call per object per frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Events")
+	bool bBroadcastPerObjectEvents = true;
+
 	// A delegate that is fired when the Augmenta Live Link source is destroyed.
 	UPROPERTY(BlueprintAssignable, Category = "Augmenta|Events")
 	FAugmentaSourceDestroyedEvent OnAugmentaSourceDestroyed;
+
+	// A delegate that is fired when an Augmenta object entered a zone.
+	UPROPERTY(BlueprintAssignable, Category = "Augmenta|Events|Zones")
+	FAugmentaZoneObjectEvent OnAugmentaZoneEnter;
+
+	// A delegate that is fired when an Augmenta object left a zone.
+	UPROPERTY(BlueprintAssignable, Category = "Augmenta|Events|Zones")
+	FAugmentaZoneObjectEvent OnAugmentaZoneLeave;
+
+	// A delegate that is fired when the number of Augmenta objects in a zone changed.
+	UPROPERTY(BlueprintAssignable, Category = "Augmenta|Events|Zones")
+	FAugmentaZoneOccupancyChangedEvent OnAugmentaZoneOccupancyChanged;
+
+	// Native counterparts of the events above. They are fired before the Blueprint events, with the same data.
+	// OnAugmentaObjectEnteredNative, OnAugmentaObjectUpdatedNative and OnAugmentaObjectLeftNative ignore bBroadcastPerObjectEvents.
+	FAugmentaSceneUpdatedNativeEvent OnAugmentaSceneUpdatedNative;
+	FAugmentaVideoOutputUpdatedNativeEvent OnAugmentaVideoOutputUpdatedNative;
+	FAugmentaObjectUpdatedNativeEvent OnAugmentaObjectEnteredNative;
+	FAugmentaObjectUpdatedNativeEvent OnAugmentaObjectUpdatedNative;
+	FAugmentaObjectUpdatedNativeEvent OnAugmentaObjectLeftNative;
+	FAugmentaFrameNativeEvent OnAugmentaFrameNative;
+	FAugmentaZoneNativeEvent OnAugmentaZoneEventNative;
+	FAugmentaSourceDestroyedNativeEvent OnAugmentaSourceDestroyedNative;
+
+	// Cell size (in Unreal units) of the spatial index used by the spatial queries. Should be around the typical query radius.
+	UPROPERTY(EditAnywhere, Category = "Augmenta|Spatial Queries", meta = (ClampMin = "1.0"))
+	float SpatialIndexCellSize = 100.0f;
+
+	/**
+	*  Get the Augmenta objects within a radius of a point. Only the X and Y coordinates are used.
+	*  @param  Center				Center of the query
+	*  @param  Radius				Radius of the query (in Unreal units)
+	*  @param  AugmentaObjects		The objects found, in no particular order
+	*/
+	UFUNCTION(BlueprintPure, Category = "Augmenta|Spatial Queries")
+	void GetAugmentaObjectsInRadius(FVector Center, float Radius, TArray<FLiveLinkAugmentaObject>& AugmentaObjects) const;
+
+	/**
+	*  Get the Augmenta objects inside an oriented rectangle. Only the X and Y coordinates are used.
+	*  @param  Center				Center of the rectangle
+	*  @param  Size				Size of the rectangle along its local X and Y axes (in Unreal units)
+	*  @param  Rotation			Rotation of the rectangle around the vertical axis (in degrees)
+	*  @param  AugmentaObjects		The objects found, in no particular order
+	*/
+	UFUNCTION(BlueprintPure, Category = "Augmenta|Spatial Queries")
+	void GetAugmentaObjectsInRect(FVector Center, FVector2D Size, float Rotation, TArray<FLiveLinkAugmentaObject>& AugmentaObjects) const;
+
+	/**
+	*  Get the Augmenta objects nearest to a point. Only the X and Y coordinates are used.
+	*  @param  Point				Point of the query
+	*  @param  Count				Maximum number of objects to return
+	*  @param  MaxDistance			Objects farther than this distance are ignored. Zero or less means no limit.
+	*  @param  AugmentaObjects		The objects found, sorted from nearest to farthest
+	*/
+	UFUNCTION(BlueprintPure, Category = "Augmenta|Spatial Queries")
+	void GetNearestAugmentaObjects(FVector Point, int Count, float MaxDistance, TArray<FLiveLinkAugmentaObject>& AugmentaObjects) const;
+
+	/**
+	*  Get the Augmenta object nearest to a point. Only the X and Y coordinates are used.
+	*  @param  AugmentaObject		The nearest object
+	*  @param  MaxDistance			Objects farther than this distance are ignored. Zero or less means no limit.
+	*  @return FALSE if no object was found
+	*/
+	UFUNCTION(BlueprintPure, Category = "Augmenta|Spatial Queries")
+	bool GetNearestAugmentaObject(FVector Point, float MaxDistance, FLiveLinkAugmentaObject& AugmentaObject) const;
+
+	// Spatial index over the objects as of the last propagated frame. Ids can be resolved with FindTrackedAugmentaObject.
+	const FLiveLinkAugmentaSpatialIndex& GetSpatialIndex() const { return SpatialIndex; }
+
+	// Objects as of the last propagated frame. Key is the AugmentaObject Id.
+	const TMap<int, FLiveLinkAugmentaObject>& GetTrackedAugmentaObjects() const { return TrackedObjects; }
+
+	// Get an object as of the last propagated frame, nullptr if the Id is unknown
+	const FLiveLinkAugmentaObject* FindTrackedAugmentaObject(int Id) const { return TrackedObjects.Find(Id); }
+
+	/**
+	*  Subscribe to the events of a single Augmenta object. Only the subscribers of an object are called when it changes,
+	*  with Entered, Updated or Left. The subscription stays valid when the object leaves and the Id comes back.
+	*  @param  Id				The Id of the Augmenta object
+	*  @param  Delegate		The delegate to call
+	*  @return The handle to pass to UnsubscribeFromAugmentaObject
+	*/
+	FDelegateHandle SubscribeToAugmentaObject(int Id, FAugmentaObjectSubscriptionNativeEvent::FDelegate&& Delegate);
+
+	// Remove a subscription made with SubscribeToAugmentaObject
+	void UnsubscribeFromAugmentaObject(int Id, FDelegateHandle Handle);
+
+	/**
+	*  Receive the object events of each frame that pass a filter. Nothing is received for frames where no event passed the filter.
+	*  @param  Filter				The events to receive
+	*  @param  Event				The event fired with the filtered entered, updated and left objects
+	*  @return The handle of the subscription
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Augmenta|Subscriptions")
+	int AddAugmentaSubscription(const FLiveLinkAugmentaSubscriptionFilter& Filter, FAugmentaFilteredFrameEvent Event);
+
+	// Native version of AddAugmentaSubscription
+	int AddAugmentaSubscriptionNative(const FLiveLinkAugmentaSubscriptionFilter& Filter, FAugmentaFrameNativeEvent::FDelegate&& Delegate);
+
+	/**
+	*  Change the filter of a subscription
+	*  @param  Handle				The handle returned by AddAugmentaSubscription
+	*  @param  Filter				The new filter
+	*  @return FALSE if the subscription does not exist
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Augmenta|Subscriptions")
+	bool SetAugmentaSubscriptionFilter(int Handle, const FLiveLinkAugmentaSubscriptionFilter& Filter);
+
+	/**
+	*  Remove a subscription
+	*  @param  Handle				The handle returned by AddAugmentaSubscription
+	*  @return FALSE if the subscription does not exist
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Augmenta|Subscriptions")
+	bool RemoveAugmentaSubscription(int Handle);
+
+protected:
+
+	// Fire the native then the Blueprint events
+	void BroadcastSceneUpdated(const FLiveLinkAugmentaScene& AugmentaScene);
+	void BroadcastVideoOutputUpdated(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
+	void BroadcastObjectEntered(const FLiveLinkAugmentaObject& AugmentaObject);
+	void BroadcastObjectUpdated(const FLiveLinkAugmentaObject& AugmentaObject);
+	void BroadcastObjectLeft(const FLiveLinkAugmentaObject& AugmentaObject);
+	void BroadcastFrame(const TArray<FLiveLinkAugmentaObject>& EnteredObjects, const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects);
+	void BroadcastZoneEvent(const FLiveLinkAugmentaZoneEvent& ZoneEvent);
+	void BroadcastSourceDestroyed();
+
+	// Keep the frame snapshot and spatial index up to date. Should be called before broadcasting the matching events.
+	void TrackAugmentaObject(const FLiveLinkAugmentaObject& AugmentaObject);
+	void UntrackAugmentaObject(int Id);
+	void ResetTrackedAugmentaObjects();
+
+private:
+
+	void GetTrackedAugmentaObjectsFromIds(const TArray<int>& Ids, TArray<FLiveLinkAugmentaObject>& AugmentaObjects) const;
+
+	void NotifyObjectSubscribers(const FLiveLinkAugmentaObject& AugmentaObject, EAugmentaLifecycleFlags Event);
+
+	struct FFilteredSubscription
+	{
+		// Zero once removed
+		int Handle = 0;
+
+		FLiveLinkAugmentaSubscriptionFilter Filter;
+
+		FAugmentaFrameNativeEvent::FDelegate NativeDelegate;
+		FAugmentaFilteredFrameEvent DynamicDelegate;
+
+		// Time of the last updates sent, for MaxUpdateRate
+		double LastUpdateTime = 0;
+
+		// Latest state of the updated objects not sent yet because of MaxUpdateRate
+		TMap<int, FLiveLinkAugmentaObject> PendingUpdates;
+
+		// Objects inside the zone of the filter, to send their enter and leave of the zone
+		TSet<int> ObjectsInZone;
+	};
+
+	int AddFilteredSubscription(FFilteredSubscription&& Subscription);
+	FFilteredSubscription* FindFilteredSubscription(int Handle);
+
+	// Filter the frame for each subscription and fire the subscriptions that have events
+	void DispatchFilteredSubscriptions(const TArray<FLiveLinkAugmentaObject>& EnteredObjects, const TArray<FLiveLinkAugmentaObject>& UpdatedObjects, const TArray<FLiveLinkAugmentaObject>& LeftObjects);
+
+	// Send the updates held back by MaxUpdateRate once they are due, even when no new frame is broadcast
+	void FlushPendingUpdates();
+
+	FTimerHandle PendingUpdatesTimerHandle;
+
+	// Objects as of the last propagated frame
+	TMap<int, FLiveLinkAugmentaObject> TrackedObjects;
+
+	FLiveLinkAugmentaSpatialIndex SpatialIndex;
+
+	// Object Id -> subscribers of this object. Shared so that subscribers can (un)subscribe while being called.
+	TMap<int, TSharedRef<FAugmentaObjectSubscriptionNativeEvent>> ObjectSubscribers;
+
+	TArray<FFilteredSubscription> FilteredSubscriptions;
+
+	// Subscriptions added while dispatching, moved to FilteredSubscriptions afterwards
+	TArray<FFilteredSubscription> AddedFilteredSubscriptions;
+
+	int NextSubscriptionHandle = 1;
+
+	bool bDispatchingFilteredSubscriptions = false;
+
+	// Reused for each subscription
+	TArray<FLiveLinkAugmentaObject> FilteredEnteredObjects;
+	TArray<FLiveLinkAugmentaObject> FilteredUpdatedObjects;
+	TArray<FLiveLinkAugmentaObject> FilteredLeftObjects;
 };
@@ -0,0 +1,122 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+#include <atomic>
+#include <type_traits>
+
+/**
+ * Single producer, multiple consumer broadcast ring buffer.
+ * The producer never waits for the consumers: each consumer keeps its own cursor and reads the elements without consuming
+ * them for the others. A consumer that falls more than the capacity behind loses the overwritten elements and is told so.
+ * Elements are copied out of the ring while the producer may overwrite them, so they must be trivially copyable.
+ */
+template<typename ElementType>
+class TLiveLinkAugmentaEventRing
+{
+	//A torn copy is discarded by Read() but must not have run any code depending on the element content.
+	//The UE math types only define their own copy under ENABLE_NAN_DIAGNOSTIC, where it still copies the components one by one.
+	static_assert(std::is_trivially_copyable_v<ElementType> || ENABLE_NAN_DIAGNOSTIC, "TLiveLinkAugmentaEventRing elements must be trivially copyable");
+
+public:
+
+	explicit TLiveLinkAugmentaEventRing(uint32 InCapacity)
+		: Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2)))
+		, IndexMask(Capacity - 1)
+		, Slots(MakeUnique<FSlot[]>(Capacity))
+	{ }
+
+	TLiveLinkAugmentaEventRing(const TLiveLinkAugmentaEventRing&) = delete;
+	TLiveLinkAugmentaEventRing& operator=(const TLiveLinkAugmentaEventRing&) = delete;
+
+	// Publish an element. Must always be called from the same thread.
+	void Publish(const ElementType& Element)
+	{
+		const uint64 Sequence = WriteSequence.load(std::memory_order_relaxed);
+		FSlot& Slot = Slots[Sequence & IndexMask];
+
+		//Invalidate the slot first so that a consumer copying it at the same time detects the overwrite
+		Slot.Sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		Slot.Element = Element;
+
+		Slot.Sequence.store(Sequence + 1, std::memory_order_release);
+		WriteSequence.store(Sequence + 1, std::memory_order_release);
+	}
+
+	// Number of elements published so far. A new consumer should start its cursor here.
+	uint64 GetWriteSequence() const { return WriteSequence.load(std::memory_order_acquire); }
+
+	uint32 GetCapacity() const { return Capacity; }
+
+	/**
+	*  Read in order the elements published after a cursor. Can be called from any thread.
+	*  When the producer overwrote elements the consumer did not read yet, the cursor jumps to the last published element.
+	*  @param  Cursor				Sequence of the next element to read, moved after the last element read
+	*  @param  Func				Called with each element read
+	*  @return The number of elements lost because they were overwritten before being read
+	*/
+	template<typename FuncType>
+	uint64 Read(uint64& Cursor, FuncType&& Func) const
+	{
+		const uint64 Published = GetWriteSequence();
+
+		if (Published - Cursor > Capacity)
+		{
+			return SkipTo(Cursor, Published);
+		}
+
+		ElementType Element;
+
+		while (Cursor < Published)
+		{
+			const FSlot& Slot = Slots[Cursor & IndexMask];
+
+			if (Slot.Sequence.load(std::memory_order_acquire) != Cursor + 1)
+			{
+				return SkipTo(Cursor, Published);
+			}
+
+			Element = Slot.Element;
+
+			//The copy is only valid if the slot was not overwritten while copying
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (Slot.Sequence.load(std::memory_order_relaxed) != Cursor + 1)
+			{
+				return SkipTo(Cursor, Published);
+			}
+
+			++Cursor;
+			Func(Element);
+		}
+
+		return 0;
+	}
+
+private:
+
+	struct FSlot
+	{
+		// Sequence of the element in the slot plus one, zero while being written
+		std::atomic<uint64> Sequence{ 0 };
+		ElementType Element;
+	};
+
+	static uint64 SkipTo(uint64& Cursor, uint64 Published)
+	{
+		const uint64 Lost = Published - Cursor;
+		Cursor = Published;
+		return Lost;
+	}
+
+	const uint32 Capacity;
+	const uint64 IndexMask;
+
+	TUniquePtr<FSlot[]> Slots;
+
+	std::atomic<uint64> WriteSequence{ 0 };
+};
@@ -0,0 +1,76 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkAugmentaData.h"
+
+// A complete Augmenta frame: the /scene message and the state of the objects after all the object messages that followed it
+struct LIVELINKAUGMENTA_API FLiveLinkAugmentaBufferedFrame
+{
+	FLiveLinkAugmentaScene AugmentaScene;
+	FLiveLinkAugmentaVideoOutput AugmentaVideoOutput;
+
+	// Incremented by each /fusion message, so that consumers know when the video output changed
+	uint32 VideoOutputRevision = 0;
+
+	TArray<FLiveLinkAugmentaObject> AugmentaObjects;
+};
+
+enum class ELiveLinkAugmentaFrameLookup : uint8
+{
+	Found,
+	// The frame was not received yet
+	Pending,
+	// The frame is older than the buffered frames or was never received
+	Missed
+};
+
+/**
+ * Last complete Augmenta frames of a source, keyed by the Frame number of their /scene message.
+ * The receiving thread pushes a frame when the /scene message of the next one arrives, so nodes of a cluster receiving the same
+ * stream can apply the same frame chosen by the primary node without the objects going through the cluster network.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaFrameBuffer
+{
+public:
+
+	explicit FLiveLinkAugmentaFrameBuffer(int32 InCapacity);
+
+	/**
+	*  Push a complete frame, overwriting the oldest one. Called from the receiving thread.
+	*  A frame number not greater than the last one means the stream restarted, the buffered frames are discarded.
+	*/
+	void Push(const FLiveLinkAugmentaScene& AugmentaScene, const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput, uint32 VideoOutputRevision, const TMap<int, FLiveLinkAugmentaObject>& AugmentaObjects);
+
+	// Remove all frames
+	void Reset();
+
+	/**
+	*  Get the frame number of a recently pushed frame. Can be called from any thread.
+	*  @param  OutFrame			The Frame number of the /scene message of the frame
+	*  @param  Age					Number of frames pushed after the requested one, 0 for the last pushed frame
+	*  @return FALSE if fewer frames are buffered
+	*/
+	bool GetLatestFrameNumber(int32& OutFrame, int32 Age = 0) const;
+
+	/**
+	*  Copy a buffered frame. Can be called from any thread.
+	*  @param  Frame				The Frame number of the /scene message of the frame
+	*  @param  OutFrame			The frame, its objects array keeps its memory
+	*/
+	ELiveLinkAugmentaFrameLookup ReadFrame(int32 Frame, FLiveLinkAugmentaBufferedFrame& OutFrame) const;
+
+private:
+
+	mutable FCriticalSection FramesLock;
+
+	// Ring of frames, slots keep their memory when overwritten
+	TArray<FLiveLinkAugmentaBufferedFrame> Frames;
+
+	// Slot of the next frame to push
+	int32 NextSlot = 0;
+
+	// Number of buffered frames
+	int32 Num = 0;
+};
@@ -4,66 +4,18 @@
 
 #include "LiveLinkAugmenta.h"
 #include "LiveLinkAugmentaData.h"
-
-#include "Containers/CircularQueue.h"
+#include "LiveLinkAugmentaZoneEngine.h"
+#include "LiveLinkAugmentaEventCoalescer.h"
 
 #include "CoreMinimal.h"
 #include "LiveLinkAugmentaEventDispatcher.h"
 #include "GameFramework/Actor.h"
 #include "LiveLinkAugmentaManager.generated.h"
 
-#define AUGMENTAEVENTQUEUECAPACITY 2048
-
 /** Forward Declarations */
 class ULiveLinkPreset;
 class FLiveLinkAugmentaSource;
 
-// Structure used to store Augmenta event data in the circular queue to transfer them between threads
-USTRUCT(BlueprintType) //BlueprintType to get access in BP
-struct FAugmentaEventData
-{
-	GENERATED_USTRUCT_BODY()
-
-	//Those are not UPROPERTY() in the circular queue 
-	//so do not store UE Actor or UE Object pointers in this struct!
-
-	// Id of the Augmenta object this event refers to. -1 = AugmentaScene, -2 = AugmentaVideoOutput
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Event Data")
-	int ObjectId = 0;
-
-	// Type of event : 0 = SceneUpdate, 1 = VideoOutputUpdate, 2 = ObjectEnter, 3 = ObjectUpdate, 4 = ObjectLeave
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Event Data")
-	int EventType = 0;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Event Data")
-	FLiveLinkAugmentaObject AugmentaObject;
-};
-
-// Augmenta event data queue used to transfer events between threads
-UCLASS()
-class UAugmentaEventDataQueue
-	: public UObject
-{
-	GENERATED_BODY()
-
-public:
-
-	//This is not UPROPERTY() so do not store UE Actor or UE Object pointers in this struct!
-	TCircularQueue<FAugmentaEventData> Events;
-
-	UAugmentaEventDataQueue(const FObjectInitializer& ObjectInitializer)
-		: Super(ObjectInitializer)
-		, Events(AUGMENTAEVENTQUEUECAPACITY)
-	{ }
-
-	UAugmentaEventDataQueue(FVTableHelper& Helper)
-		: Super(Helper)
-		, Events(AUGMENTAEVENTQUEUECAPACITY)
-	{ }
-
-	//1024 = max number of items queue can store, can store more as you dequeue all items of course
-};
-
 UCLASS(BlueprintType, Category = "Augmenta")
 class LIVELINKAUGMENTA_API ALiveLinkAugmentaManager : public ALiveLinkAugmentaEventDispatcher
 {
@@ -77,6 +29,8 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:	
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
@@ -89,19 +43,47 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Augmenta|Live Link")
 	FName SceneName;
 
-	// Time in seconds between each Live Link source search.
-	UPROPERTY(EditAnywhere, Category = "Augmenta|Live Link")
-	float SourceSearchDelay;
-
 	// Is this manager currently connected to a Live Link Source ?
 	UPROPERTY(VisibleAnywhere, Category = "Augmenta|Live Link")
 	bool bIsConnected;
 
 
-	// The event count threshold (in percentage of the event queue capacity) above which warnings are issued
+	// Read object updates from the latest state slots of the source instead of the source update event ring, so that no update can be lost.
+	// Entered, left, scene and video output events are always read from their own ring, which object updates never overwrite.
+	UPROPERTY(EditAnywhere, Category = "Augmenta|Events")
+	bool bUseLatestStateSlots = false;
+
+	// The count of unread events (in percentage of the source event rings capacity) above which warnings are issued
 	UPROPERTY(EditAnywhere, Category = "Augmenta|Events", meta = (ClampMin = "0.0", ClampMax = "1.0"))
 	float EventQueueCapacityWarningThreshold = 0.8f;
 
+	// Number of events overwritten in the source event rings before this manager could read them.
+	// The objects are resynchronized from the source latest states when it happens.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Events")
+	int LostEventCount = 0;
+
+	// Number of zone events overwritten in the source zone event ring before this manager could read them.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Events")
+	int LostZoneEventCount = 0;
+
+	// Maximum time (in ms) spent propagating events each frame. Zero or less means no limit.
+	// Scene, video output, entered and left events are always propagated, object updates that do not fit are carried over
+	// to the next frame with their newest state, and are always propagated then. The tracked objects and spatial queries are never delayed.
+	UPROPERTY(EditAnywhere, Category = "Augmenta|Events", meta = (ClampMin = "0.0"))
+	float PropagationTimeBudget = 0;
+
+	// Number of frames where the propagation time budget ran out
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Events|Stats")
+	int BudgetOverrunCount = 0;
+
+	// Number of object updates carried over to the next frame at the end of the last frame
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Events|Stats")
+	int CarriedOverEventCount = 0;
+
+	// Total number of object updates carried over to a later frame
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Augmenta|Events|Stats")
+	int TotalCarriedOverEventCount = 0;
+
 	/**
 	*  Get the Augmenta Scene 
 	*  @param  AugmentaScene       Augmenta Scene
@@ -139,27 +121,76 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Augmenta|VideoOutput")
 	bool GetAugmentaVideoOutput(FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
 
-	UPROPERTY()
-	UAugmentaEventDataQueue* AugmentaEventDataQueue = nullptr;
+	/**
+	*  Replace the zones evaluated by the connected Live Link source, overriding the zones of the source settings.
+	*  Zone coordinates are in Unreal units, in the same space as the objects Position.
+	*  @param  Zones				The zones to evaluate
+	*  @return FALSE if Augmenta Manager source is not valid
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Augmenta|Zones")
+	bool SetAugmentaZones(const TArray<FLiveLinkAugmentaZone>& Zones);
+
+	// Get the connected Live Link source, nullptr if not connected
+	FLiveLinkAugmentaSource* GetLiveLinkAugmentaSource() const { return bIsConnected ? LiveLinkAugmentaSource : nullptr; }
 
 private:
 
 	FLiveLinkAugmentaSource* LiveLinkAugmentaSource;
 
-	FTimerHandle SearchSourceTimerHandle;
+	FDelegateHandle SourceRegisteredHandle;
+
+	void OnAugmentaSourceRegistered(FName RegisteredSceneName, FLiveLinkAugmentaSource* Source);
+
+	FDelegateHandle SourceUnregisteredHandle;
+
+	void OnAugmentaSourceUnregistered(FName UnregisteredSceneName, FLiveLinkAugmentaSource* Source);
+
+	void AttachToLiveLinkSource(FLiveLinkAugmentaSource* Source);
 
-	void SearchLiveLinkSource();
+	void DetachFromLiveLinkSource();
 
-	void OnLiveLinkAugmentaSceneUpdated(FLiveLinkAugmentaScene AugmentaScene);
-	void OnLiveLinkAugmentaVideoOutputUpdated(FLiveLinkAugmentaVideoOutput AugmentaVideoOutput);
-	void OnLiveLinkAugmentaObjectEntered(FLiveLinkAugmentaObject AugmentaObject);
-	void OnLiveLinkAugmentaObjectUpdated(FLiveLinkAugmentaObject AugmentaObject);
-	void OnLiveLinkAugmentaObjectWillLeave(FLiveLinkAugmentaObject AugmentaObject);
 	void OnLiveLinkAugmentaSourceDestroyed();
 
+	// Coalesce an object event, turning an update of an unknown object into an enter
+	void CoalesceEvent(int ObjectId, int EventType, const FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Coalesce the latest state of an object, unless the events of the frame already hold a newer state of it
+	void CoalesceUpdate(const FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Coalesce the difference between the tracked objects and the source latest states, after events were lost
+	void CoalesceResyncEvents();
+
 	void PropagateLiveLinkEvents();
-	void PropagateLiveLinkEventFromEventData(FAugmentaEventData EventData);
+	void PropagateLiveLinkEvent(int EventType, const FLiveLinkAugmentaObject& AugmentaObject);
+	void PropagateZoneEvents();
+
+	FDelegateHandle SourceDestroyedHandle;
+
+	// Our read positions in the source event rings
+	uint64 EventRingCursor = 0;
+	uint64 UpdateEventRingCursor = 0;
+	uint64 ZoneEventRingCursor = 0;
+
+	// Whether the objects must be resynchronized from the source latest states
+	bool bNeedsResync = false;
+
+	// Ids of the source latest states during a resync, reused between resyncs
+	TSet<int> ResyncObjectIds;
+
+	// Version of the source state slots at the last read
+	uint64 LastReadStateVersion = 0;
+
+	// Objects read from the source state slots, reused between frames
+	TArray<FLiveLinkAugmentaObject> ChangedObjectStates;
+
+	// Objects passed to OnAugmentaFrame, reused between frames
+	TArray<FLiveLinkAugmentaObject> FrameEnteredObjects;
+	TArray<FLiveLinkAugmentaObject> FrameUpdatedObjects;
+	TArray<FLiveLinkAugmentaObject> FrameLeftObjects;
+
+	// Events of the current frame coalesced per object id. Keeps its memory between frames.
+	FLiveLinkAugmentaEventCoalescer EventCoalescer;
 
-	UPROPERTY()
-	TArray<FAugmentaEventData> EventDataCache;
+	// Object updates that did not fit in the time budget, propagated first next frame
+	TArray<FLiveLinkAugmentaObject> CarriedOverUpdates;
 };
@@ -0,0 +1,53 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkAugmentaData.h"
+
+#include <atomic>
+
+/**
+ * Latest state of each Augmenta object, one slot per object Id.
+ * The receiving thread overwrites the slot of an object on every update, so memory use only depends on the number of objects
+ * and never on the send rate. Every write is stamped with a global version so that any number of consumers can
+ * fetch what changed since their last read without consuming it for the others.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaObjectStateSlots
+{
+public:
+
+	// Write the latest state of an object. Called from the receiving thread.
+	void Write(const FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Remove the slot of an object. Called from the receiving thread.
+	void Remove(int Id);
+
+	// Remove all slots
+	void Reset();
+
+	// Version of the last write
+	uint64 GetVersion() const { return Version.load(std::memory_order_acquire); }
+
+	/**
+	*  Get the objects written after a given version. Can be called from any thread.
+	*  @param  SinceVersion			The version returned by the previous call, 0 to get every object
+	*  @param  OutObjects			The changed objects are appended to this array
+	*  @return The version to pass to the next call
+	*/
+	uint64 ReadChangedSince(uint64 SinceVersion, TArray<FLiveLinkAugmentaObject>& OutObjects) const;
+
+private:
+
+	struct FSlot
+	{
+		uint64 Version = 0;
+		FLiveLinkAugmentaObject AugmentaObject;
+	};
+
+	mutable FRWLock SlotsLock;
+
+	TMap<int, FSlot> Slots;
+
+	std::atomic<uint64> Version{ 0 };
+};
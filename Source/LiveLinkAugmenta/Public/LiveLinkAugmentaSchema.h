@@ -0,0 +1,417 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkAugmentaData.h"
+#include "LiveLinkAugmentaClusterCodec.h"
+#include "Templates/IntegerSequence.h"
+#include "Templates/IntegralConstant.h"
+
+// OSC message of the Augmenta protocol a field is read from
+enum class EAugmentaOscMessage : uint8
+{
+	None,
+	Scene,
+	Fusion,
+	Object,
+	ObjectExtra
+};
+
+// Encoding of a field in the compact cluster wire format
+enum class EAugmentaCompactEncoding : uint8
+{
+	// Encoded with the other fields of its group by FLiveLinkAugmentaClusterCodec (quantized transforms, Id)
+	Custom,
+	Float,
+	VarInt
+};
+
+/**
+ * One member of an Augmenta structure, with its OSC argument, json key and compact encoding.
+ * Values go through a double, which holds every int32 and float exactly.
+ */
+template<typename StructType>
+struct TAugmentaSchemaField
+{
+	// Key of the field in the json cluster events
+	const TCHAR* JsonKey;
+
+	// Read as an OSC int32 and written as a json integer, otherwise an OSC float32
+	bool bIsInteger;
+
+	// Sent with the reduced object data (bSendReducedObjectData)
+	bool bIsReduced;
+
+	EAugmentaOscMessage OscMessage;
+
+	// Index of the argument in the OSC message
+	int32 OscIndex;
+
+	// Factor applied to the OSC value, to convert meters to Unreal units
+	double OscScale;
+
+	// Group of the field in the compact object mask, None for the scene and video output
+	EAugmentaClusterObjectFields CompactGroup;
+
+	EAugmentaCompactEncoding CompactEncoding;
+
+	double (*Get)(const StructType&);
+	void (*Set)(StructType&, double);
+};
+
+/**
+ * Single description of the Augmenta messages, from which the OSC decoder, the json codec and the compact codec are generated.
+ * The layouts of the OSC messages, the json keys and the compact wire format are checked at compile time below:
+ * a change to a table that breaks the wire format fails to compile until FLiveLinkAugmentaClusterCodec::FormatVersion is updated.
+ */
+namespace LiveLinkAugmentaSchema
+{
+	// Frame, Id and Oid of the object, read by the source to find the object to update
+	constexpr int32 ObjectExtraHeaderCount = 3;
+
+	constexpr double MetersToUnrealUnits = 100.0;
+
+#define AUGMENTA_SCHEMA_FIELD(StructType, JsonKey, Member, bIsInteger, bIsReduced, OscMessage, OscIndex, OscScale, CompactGroup, CompactEncoding) \
+	TAugmentaSchemaField<StructType>{ TEXT(JsonKey), bIsInteger, bIsReduced, EAugmentaOscMessage::OscMessage, OscIndex, OscScale, \
+		EAugmentaClusterObjectFields::CompactGroup, EAugmentaCompactEncoding::CompactEncoding, \
+		[](const StructType& Value) -> double { return Value.Member; }, \
+		[](StructType& Value, double FieldValue) { Value.Member = (decltype(Value.Member))FieldValue; } }
+
+	// Fields not read from OSC are computed by the source from the others
+#define AUGMENTA_SCENE_INT(JsonKey, Member, OscIndex) AUGMENTA_SCHEMA_FIELD(FLiveLinkAugmentaScene, JsonKey, Member, true, false, Scene, OscIndex, 1.0, None, VarInt)
+#define AUGMENTA_SCENE_FLOAT(JsonKey, Member, OscIndex) AUGMENTA_SCHEMA_FIELD(FLiveLinkAugmentaScene, JsonKey, Member, false, false, Scene, OscIndex, 1.0, None, Float)
+#define AUGMENTA_SCENE_COMPUTED(JsonKey, Member) AUGMENTA_SCHEMA_FIELD(FLiveLinkAugmentaScene, JsonKey, Member, false, false, None, -1, 1.0, None, Float)
+
+	inline constexpr TAugmentaSchemaField<FLiveLinkAugmentaScene> SceneFields[] =
+	{
+		AUGMENTA_SCENE_INT("Frame", Frame, 0),
+		AUGMENTA_SCENE_INT("ObjectCount", ObjectCount, 1),
+		AUGMENTA_SCENE_FLOAT("SizeX", Size.X, 2),
+		AUGMENTA_SCENE_FLOAT("SizeY", Size.Y, 3),
+		AUGMENTA_SCENE_COMPUTED("PositionX", Position.X),
+		AUGMENTA_SCENE_COMPUTED("PositionY", Position.Y),
+		AUGMENTA_SCENE_COMPUTED("PositionZ", Position.Z),
+		AUGMENTA_SCENE_COMPUTED("RotationX", Rotation.X),
+		AUGMENTA_SCENE_COMPUTED("RotationY", Rotation.Y),
+		AUGMENTA_SCENE_COMPUTED("RotationZ", Rotation.Z),
+		AUGMENTA_SCENE_COMPUTED("RotationW", Rotation.W),
+		AUGMENTA_SCENE_COMPUTED("ScaleX", Scale.X),
+		AUGMENTA_SCENE_COMPUTED("ScaleY", Scale.Y),
+		AUGMENTA_SCENE_COMPUTED("ScaleZ", Scale.Z)
+	};
+
+#define AUGMENTA_VIDEO_INT(JsonKey, Member, OscIndex) AUGMENTA_SCHEMA_FIELD(FLiveLinkAugmentaVideoOutput, JsonKey, Member, true, false, Fusion, OscIndex, 1.0, None, VarInt)
+#define AUGMENTA_VIDEO_FLOAT(JsonKey, Member, OscIndex, OscScale) AUGMENTA_SCHEMA_FIELD(FLiveLinkAugmentaVideoOutput, JsonKey, Member, false, false, Fusion, OscIndex, OscScale, None, Float)
+#define AUGMENTA_VIDEO_COMPUTED(JsonKey, Member) AUGMENTA_SCHEMA_FIELD(FLiveLinkAugmentaVideoOutput, JsonKey, Member, false, false, None, -1, 1.0, None, Float)
+
+	inline constexpr TAugmentaSchemaField<FLiveLinkAugmentaVideoOutput> VideoOutputFields[] =
+	{
+		AUGMENTA_VIDEO_FLOAT("OffsetX", Offset.X, 0, MetersToUnrealUnits),
+		AUGMENTA_VIDEO_FLOAT("OffsetY", Offset.Y, 1, MetersToUnrealUnits),
+		AUGMENTA_VIDEO_FLOAT("SizeX", Size.X, 2, 1.0),
+		AUGMENTA_VIDEO_FLOAT("SizeY", Size.Y, 3, 1.0),
+		AUGMENTA_VIDEO_INT("ResolutionX", Resolution.X, 4),
+		AUGMENTA_VIDEO_INT("ResolutionY", Resolution.Y, 5),
+		AUGMENTA_VIDEO_COMPUTED("PositionX", Position.X),
+		AUGMENTA_VIDEO_COMPUTED("PositionY", Position.Y),
+		AUGMENTA_VIDEO_COMPUTED("PositionZ", Position.Z),
+		AUGMENTA_VIDEO_COMPUTED("RotationX", Rotation.X),
+		AUGMENTA_VIDEO_COMPUTED("RotationY", Rotation.Y),
+		AUGMENTA_VIDEO_COMPUTED("RotationZ", Rotation.Z),
+		AUGMENTA_VIDEO_COMPUTED("RotationW", Rotation.W),
+		AUGMENTA_VIDEO_COMPUTED("ScaleX", Scale.X),
+		AUGMENTA_VIDEO_COMPUTED("ScaleY", Scale.Y),
+		AUGMENTA_VIDEO_COMPUTED("ScaleZ", Scale.Z)
+	};
+
+#define AUGMENTA_OBJECT_INT(JsonKey, Member, bIsReduced, OscMessage, OscIndex, CompactGroup, CompactEncoding) AUGMENTA_SCHEMA_FIELD(FLiveLinkAugmentaObject, JsonKey, Member, true, bIsReduced, OscMessage, OscIndex, 1.0, CompactGroup, CompactEncoding)
+#define AUGMENTA_OBJECT_FLOAT(JsonKey, Member, bIsReduced, OscMessage, OscIndex, CompactGroup) AUGMENTA_SCHEMA_FIELD(FLiveLinkAugmentaObject, JsonKey, Member, false, bIsReduced, OscMessage, OscIndex, 1.0, CompactGroup, Float)
+#define AUGMENTA_OBJECT_COMPUTED(JsonKey, Member, CompactGroup) AUGMENTA_SCHEMA_FIELD(FLiveLinkAugmentaObject, JsonKey, Member, false, true, None, -1, 1.0, CompactGroup, Custom)
+
+	// LastUpdateTime is not a number, each codec handles it on its own
+	inline constexpr TAugmentaSchemaField<FLiveLinkAugmentaObject> ObjectFields[] =
+	{
+		AUGMENTA_OBJECT_INT("Frame", Frame, false, Object, 0, Frame, VarInt),
+		AUGMENTA_OBJECT_INT("Id", Id, true, Object, 1, None, Custom),
+		AUGMENTA_OBJECT_INT("Oid", Oid, true, Object, 2, Oid, VarInt),
+		AUGMENTA_OBJECT_FLOAT("Age", Age, true, Object, 3, Age),
+		AUGMENTA_OBJECT_FLOAT("CentroidX", Centroid.X, false, Object, 4, Centroid),
+		AUGMENTA_OBJECT_FLOAT("CentroidY", Centroid.Y, false, Object, 5, Centroid),
+		AUGMENTA_OBJECT_FLOAT("VelocityX", Velocity.X, false, Object, 6, Velocity),
+		AUGMENTA_OBJECT_FLOAT("VelocityY", Velocity.Y, false, Object, 7, Velocity),
+		AUGMENTA_OBJECT_FLOAT("Orientation", Orientation, false, Object, 8, Orientation),
+		AUGMENTA_OBJECT_FLOAT("BoundingRectPosX", BoundingRectPos.X, false, Object, 9, BoundingRect),
+		AUGMENTA_OBJECT_FLOAT("BoundingRectPosY", BoundingRectPos.Y, false, Object, 10, BoundingRect),
+		AUGMENTA_OBJECT_FLOAT("BoundingRectSizeX", BoundingRectSize.X, false, Object, 11, BoundingRect),
+		AUGMENTA_OBJECT_FLOAT("BoundingRectSizeY", BoundingRectSize.Y, false, Object, 12, BoundingRect),
+		AUGMENTA_OBJECT_FLOAT("BoundingRectRotation", BoundingRectRotation, false, Object, 13, BoundingRect),
+		AUGMENTA_OBJECT_FLOAT("Height", Height, false, Object, 14, Height),
+
+		AUGMENTA_OBJECT_FLOAT("HighestX", Highest.X, false, ObjectExtra, 3, Highest),
+		AUGMENTA_OBJECT_FLOAT("HighestY", Highest.Y, false, ObjectExtra, 4, Highest),
+		AUGMENTA_OBJECT_FLOAT("Distance", Distance, false, ObjectExtra, 5, Distance),
+		AUGMENTA_OBJECT_FLOAT("Reflectivity", Reflectivity, false, ObjectExtra, 6, Reflectivity),
+
+		AUGMENTA_OBJECT_COMPUTED("PositionX", Position.X, Position),
+		AUGMENTA_OBJECT_COMPUTED("PositionY", Position.Y, Position),
+		AUGMENTA_OBJECT_COMPUTED("PositionZ", Position.Z, Position),
+		AUGMENTA_OBJECT_COMPUTED("RotationX", Rotation.X, Rotation),
+		AUGMENTA_OBJECT_COMPUTED("RotationY", Rotation.Y, Rotation),
+		AUGMENTA_OBJECT_COMPUTED("RotationZ", Rotation.Z, Rotation),
+		AUGMENTA_OBJECT_COMPUTED("RotationW", Rotation.W, Rotation),
+		AUGMENTA_OBJECT_COMPUTED("ScaleX", Scale.X, Scale),
+		AUGMENTA_OBJECT_COMPUTED("ScaleY", Scale.Y, Scale),
+		AUGMENTA_OBJECT_COMPUTED("ScaleZ", Scale.Z, Scale)
+	};
+
+#undef AUGMENTA_OBJECT_COMPUTED
+#undef AUGMENTA_OBJECT_FLOAT
+#undef AUGMENTA_OBJECT_INT
+#undef AUGMENTA_VIDEO_COMPUTED
+#undef AUGMENTA_VIDEO_FLOAT
+#undef AUGMENTA_VIDEO_INT
+#undef AUGMENTA_SCENE_COMPUTED
+#undef AUGMENTA_SCENE_FLOAT
+#undef AUGMENTA_SCENE_INT
+#undef AUGMENTA_SCHEMA_FIELD
+
+	// Indices of some fields of a table, in the order they are read or written
+	template<int32 MaxCount>
+	struct TFieldOrder
+	{
+		int32 Indices[MaxCount] = {};
+		int32 Num = 0;
+	};
+
+	// Fields of an OSC message, in argument order
+	template<typename StructType, int32 FieldCount>
+	constexpr TFieldOrder<FieldCount> MakeOscOrder(const TAugmentaSchemaField<StructType>(&Fields)[FieldCount], EAugmentaOscMessage Message)
+	{
+		TFieldOrder<FieldCount> Order;
+
+		for (int32 Index = 0; Index < 64; Index++)
+		{
+			for (int32 i = 0; i < FieldCount; i++)
+			{
+				if (Fields[i].OscMessage == Message && Fields[i].OscIndex == Index)
+				{
+					Order.Indices[Order.Num++] = i;
+				}
+			}
+		}
+
+		return Order;
+	}
+
+	// Fields of the compact format not encoded by hand, in wire order: by group, then in table order
+	template<typename StructType, int32 FieldCount>
+	constexpr TFieldOrder<FieldCount> MakeCompactOrder(const TAugmentaSchemaField<StructType>(&Fields)[FieldCount])
+	{
+		TFieldOrder<FieldCount> Order;
+
+		for (int32 Bit = -1; Bit < 16; Bit++)
+		{
+			const uint32 Group = Bit < 0 ? 0 : 1u << Bit;
+
+			for (int32 i = 0; i < FieldCount; i++)
+			{
+				if (Fields[i].CompactEncoding != EAugmentaCompactEncoding::Custom && (uint32)Fields[i].CompactGroup == Group)
+				{
+					Order.Indices[Order.Num++] = i;
+				}
+			}
+		}
+
+		return Order;
+	}
+
+	// Size in bytes of the fixed size fields of a compact group
+	template<typename StructType, int32 FieldCount>
+	constexpr int32 GetCompactFixedSize(const TAugmentaSchemaField<StructType>(&Fields)[FieldCount], EAugmentaClusterObjectFields Group)
+	{
+		int32 Size = 0;
+
+		for (int32 i = 0; i < FieldCount; i++)
+		{
+			Size += Fields[i].CompactGroup == Group && Fields[i].CompactEncoding == EAugmentaCompactEncoding::Float ? sizeof(float) : 0;
+		}
+
+		return Size;
+	}
+
+	// Groups with at least one field encoded from the table
+	template<typename StructType, int32 FieldCount>
+	constexpr uint32 GetGeneratedCompactGroups(const TAugmentaSchemaField<StructType>(&Fields)[FieldCount])
+	{
+		uint32 Groups = 0;
+
+		for (int32 i = 0; i < FieldCount; i++)
+		{
+			Groups |= Fields[i].CompactEncoding != EAugmentaCompactEncoding::Custom ? (uint32)Fields[i].CompactGroup : 0;
+		}
+
+		return Groups;
+	}
+
+	// Compact groups of the fields of the reduced data
+	template<typename StructType, int32 FieldCount>
+	constexpr uint32 GetReducedCompactGroups(const TAugmentaSchemaField<StructType>(&Fields)[FieldCount])
+	{
+		uint32 Groups = 0;
+
+		for (int32 i = 0; i < FieldCount; i++)
+		{
+			Groups |= Fields[i].bIsReduced ? (uint32)Fields[i].CompactGroup : 0;
+		}
+
+		return Groups;
+	}
+
+	// Bit i set if field i is part of the reduced data
+	template<typename StructType, int32 FieldCount>
+	constexpr uint64 GetReducedFieldsMask(const TAugmentaSchemaField<StructType>(&Fields)[FieldCount])
+	{
+		uint64 Mask = 0;
+
+		for (int32 i = 0; i < FieldCount; i++)
+		{
+			Mask |= Fields[i].bIsReduced ? 1ull << i : 0;
+		}
+
+		return Mask;
+	}
+
+	// Whether the OSC arguments of a message are numbered without gaps nor duplicates, after FirstIndex
+	template<typename StructType, int32 FieldCount>
+	constexpr bool IsOscLayoutValid(const TAugmentaSchemaField<StructType>(&Fields)[FieldCount], EAugmentaOscMessage Message, int32 FirstIndex, int32 ArgumentCount)
+	{
+		for (int32 Index = FirstIndex; Index < ArgumentCount; Index++)
+		{
+			int32 Count = 0;
+
+			for (int32 i = 0; i < FieldCount; i++)
+			{
+				Count += Fields[i].OscMessage == Message && Fields[i].OscIndex == Index ? 1 : 0;
+			}
+
+			if (Count != 1)
+			{
+				return false;
+			}
+		}
+
+		return MakeOscOrder(Fields, Message).Num == ArgumentCount - FirstIndex;
+	}
+
+	template<typename StructType, int32 FieldCount>
+	constexpr bool AreJsonKeysUnique(const TAugmentaSchemaField<StructType>(&Fields)[FieldCount])
+	{
+		for (int32 i = 0; i < FieldCount; i++)
+		{
+			for (int32 j = i + 1; j < FieldCount; j++)
+			{
+				const TCHAR* A = Fields[i].JsonKey;
+				const TCHAR* B = Fields[j].JsonKey;
+
+				while (*A && *A == *B) { A++; B++; }
+
+				if (*A == *B)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	inline constexpr TFieldOrder<UE_ARRAY_COUNT(SceneFields)> SceneOscOrder = MakeOscOrder(SceneFields, EAugmentaOscMessage::Scene);
+	inline constexpr TFieldOrder<UE_ARRAY_COUNT(VideoOutputFields)> VideoOutputOscOrder = MakeOscOrder(VideoOutputFields, EAugmentaOscMessage::Fusion);
+	inline constexpr TFieldOrder<UE_ARRAY_COUNT(ObjectFields)> ObjectOscOrder = MakeOscOrder(ObjectFields, EAugmentaOscMessage::Object);
+	inline constexpr TFieldOrder<UE_ARRAY_COUNT(ObjectFields)> ObjectExtraOscOrder = MakeOscOrder(ObjectFields, EAugmentaOscMessage::ObjectExtra);
+
+	inline constexpr TFieldOrder<UE_ARRAY_COUNT(SceneFields)> SceneCompactOrder = MakeCompactOrder(SceneFields);
+	inline constexpr TFieldOrder<UE_ARRAY_COUNT(VideoOutputFields)> VideoOutputCompactOrder = MakeCompactOrder(VideoOutputFields);
+	inline constexpr TFieldOrder<UE_ARRAY_COUNT(ObjectFields)> ObjectCompactOrder = MakeCompactOrder(ObjectFields);
+
+	// Augmenta protocol V2
+	static_assert(IsOscLayoutValid(SceneFields, EAugmentaOscMessage::Scene, 0, 4), "/scene has 4 arguments");
+	static_assert(IsOscLayoutValid(VideoOutputFields, EAugmentaOscMessage::Fusion, 0, 6), "/fusion has 6 arguments");
+	static_assert(IsOscLayoutValid(ObjectFields, EAugmentaOscMessage::Object, 0, 15), "/object/update has 15 arguments");
+	static_assert(IsOscLayoutValid(ObjectFields, EAugmentaOscMessage::ObjectExtra, ObjectExtraHeaderCount, 7), "/object/update/extra has 7 arguments");
+
+	static_assert(AreJsonKeysUnique(SceneFields) && AreJsonKeysUnique(VideoOutputFields) && AreJsonKeysUnique(ObjectFields), "Json keys must be unique");
+	static_assert(UE_ARRAY_COUNT(ObjectFields) <= 57, "The json codec tracks the object fields and the 7 LastUpdateTime keys in a 64 bit mask");
+	static_assert(GetReducedFieldsMask(ObjectFields) == ((1ull << 1) | (1ull << 2) | (1ull << 3) | (((1ull << 10) - 1) << 19)), "The reduced data are the Id, Oid, Age and transform");
+
+	// The Oid names the Live Link subjects of the objects on the receiving nodes
+	static_assert(GetReducedCompactGroups(ObjectFields) == (uint32)EAugmentaClusterObjectFields::Reduced, "The json and compact reduced data must hold the same fields");
+
+	// The scene and video output are encoded whole, in table order
+	static_assert(SceneCompactOrder.Num == UE_ARRAY_COUNT(SceneFields) && VideoOutputCompactOrder.Num == UE_ARRAY_COUNT(VideoOutputFields), "Scene and video output fields can not be custom");
+
+	// Position, Rotation, Scale and LastUpdateTime are quantized or not in the table, the Id precedes the field mask
+	static_assert(GetGeneratedCompactGroups(ObjectFields) == ((uint32)EAugmentaClusterObjectFields::All
+		& ~(uint32)(EAugmentaClusterObjectFields::Position | EAugmentaClusterObjectFields::Rotation | EAugmentaClusterObjectFields::Scale | EAugmentaClusterObjectFields::LastUpdateTime)),
+		"Every compact group but the custom ones must have fields in the table");
+
+	// Compact format version 1: 4 bytes per float, Frame and Oid as varints
+	static_assert(GetCompactFixedSize(ObjectFields, EAugmentaClusterObjectFields::BoundingRect) == 20 && GetCompactFixedSize(ObjectFields, EAugmentaClusterObjectFields::Centroid) == 8
+		&& GetCompactFixedSize(ObjectFields, EAugmentaClusterObjectFields::Highest) == 8 && GetCompactFixedSize(ObjectFields, EAugmentaClusterObjectFields::Age) == 4,
+		"The compact object layout changed, increment FLiveLinkAugmentaClusterCodec::FormatVersion and update this check");
+	static_assert(FLiveLinkAugmentaClusterCodec::FormatVersion == 1, "Update the compact layout checks for the new format version");
+
+	// Call Function with each index of Order as a compile time constant, in order
+	template<const auto& Order, typename FunctionType, int32... Indices>
+	FORCEINLINE void ForEachField(FunctionType&& Function, TIntegerSequence<int32, Indices...>)
+	{
+		(Function(TIntegralConstant<int32, Order.Indices[Indices]>()), ...);
+	}
+
+	template<const auto& Order, typename FunctionType>
+	FORCEINLINE void ForEachField(FunctionType&& Function)
+	{
+		ForEachField<Order>(Forward<FunctionType>(Function), TMakeIntegerSequence<int32, Order.Num>());
+	}
+
+	/**
+	*  Read the arguments of an OSC message into a structure, unrolled at compile time
+	*  @param  Fields				The table of the structure
+	*  @param  Order				The OSC order of the message
+	*  @param  Args				The OSC argument stream, positioned on the first argument of the table
+	*/
+	template<const auto& Fields, const auto& Order, typename ArgStreamType, typename StructType>
+	FORCEINLINE void ReadOsc(ArgStreamType& Args, StructType& Value)
+	{
+		ForEachField<Order>([&Args, &Value](auto Index)
+		{
+			constexpr const auto& Field = Fields[decltype(Index)::Value];
+
+			if constexpr (Field.bIsInteger)
+			{
+				Field.Set(Value, Args.int32());
+			}
+			else if constexpr (Field.OscScale != 1.0)
+			{
+				Field.Set(Value, Args.float32() * Field.OscScale);
+			}
+			else
+			{
+				Field.Set(Value, Args.float32());
+			}
+		});
+	}
+
+	// Copy the fields of Order from one structure to another, unrolled at compile time
+	template<const auto& Fields, const auto& Order, typename StructType>
+	FORCEINLINE void CopyFields(const StructType& Source, StructType& Destination)
+	{
+		ForEachField<Order>([&Source, &Destination](auto Index)
+		{
+			constexpr const auto& Field = Fields[decltype(Index)::Value];
+
+			Field.Set(Destination, Field.Get(Source));
+		});
+	}
+}
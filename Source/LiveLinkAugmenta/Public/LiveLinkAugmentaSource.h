@@ -6,6 +6,12 @@
 #include "LiveLinkAugmentaConnectionSettings.h"
 #include "LiveLinkAugmentaSourceSettings.h"
 #include "LiveLinkAugmentaData.h"
+#include "LiveLinkAugmentaSpatialIndex.h"
+#include "LiveLinkAugmentaZoneEngine.h"
+#include "LiveLinkAugmentaObjectStateSlots.h"
+#include "LiveLinkAugmentaEventRing.h"
+#include "LiveLinkAugmentaFrameBuffer.h"
+#include "LiveLinkAugmentaSubjectPusher.h"
 #include "Roles/LiveLinkTransformTypes.h"
 
 #include "Delegates/IDelegateInstance.h"
@@ -30,11 +36,31 @@ struct ULiveLinkAugmentaSettings;
 
 class ILiveLinkClient;
 
+#define AUGMENTAEVENTRINGCAPACITY 4096
+#define AUGMENTAUPDATEEVENTRINGCAPACITY 4096
+#define AUGMENTAZONEEVENTRINGCAPACITY 1024
+#define AUGMENTAFRAMEBUFFERCAPACITY 16
+
+// Base and extra OSC messages of an object waiting to be published as a single update
+struct FAugmentaPendingObjectMessage
+{
+	FLiveLinkAugmentaObject AugmentaObject;
+
+	// Augmenta frame of the waiting message
+	int32 Frame = 0;
+
+	// Event of the base message: 2 entered, 3 updated, 4 left
+	int32 EventType = 0;
+
+	bool bHasBase = false;
+	bool bHasExtra = false;
+
+	// FPlatformTime::Seconds() when the waiting message was received
+	double ReceiveTime = 0;
+};
+
 /** Delegates */
-DECLARE_DELEGATE_OneParam(FLiveLinkAugmentaSceneUpdatedEvent, FLiveLinkAugmentaScene);
-DECLARE_DELEGATE_OneParam(FLiveLinkAugmentaObjectUpdatedEvent, FLiveLinkAugmentaObject);
-DECLARE_DELEGATE_OneParam(FLiveLinkAugmentaVideoOutputUpdatedEvent, FLiveLinkAugmentaVideoOutput);
-DECLARE_DELEGATE(FLiveLinkAugmentaSourceDestroyedEvent);
+DECLARE_MULTICAST_DELEGATE(FLiveLinkAugmentaSourceDestroyedEvent);
 
 class LIVELINKAUGMENTA_API FLiveLinkAugmentaSource : public ILiveLinkSource, public FRunnable, public TSharedFromThis<FLiveLinkAugmentaSource>
 {
@@ -75,20 +101,18 @@ public:
 
 	// End FRunnable Interface
 
-	/** A delegate that is fired when an Augmenta scene message is generated. */
-	FLiveLinkAugmentaSceneUpdatedEvent OnLiveLinkAugmentaSceneUpdated;
-
-	/** A delegate that is fired when an Augmenta Object Entered message is generated. */
-	FLiveLinkAugmentaObjectUpdatedEvent OnLiveLinkAugmentaObjectEntered;
-
-	/** A delegate that is fired when an Augmenta Object Updated message is generated. */
-	FLiveLinkAugmentaObjectUpdatedEvent OnLiveLinkAugmentaObjectUpdated;
+	/**
+	 * Scene, video output, object entered and object left events published by the receiving thread.
+	 * Each consumer reads them with its own cursor, so any number of consumers can follow the same source.
+	 * Object updates are published to their own ring so that they never overwrite these events, whatever the send rate.
+	 */
+	const TLiveLinkAugmentaEventRing<FAugmentaEventData>& GetEventRing() const { return EventRing; }
 
-	/** A delegate that is fired when an Augmenta Object Will Leave message is generated. */
-	FLiveLinkAugmentaObjectUpdatedEvent OnLiveLinkAugmentaObjectWillLeave;
+	/** Object updated events published by the receiving thread. */
+	const TLiveLinkAugmentaEventRing<FAugmentaEventData>& GetUpdateEventRing() const { return UpdateEventRing; }
 
-	/** A delegate that is fired when an Augmenta video output (fusion) message is generated. */
-	FLiveLinkAugmentaVideoOutputUpdatedEvent OnLiveLinkAugmentaVideoOutputUpdated;
+	/** Zone events published by the receiving thread. */
+	const TLiveLinkAugmentaEventRing<FLiveLinkAugmentaZoneEvent>& GetZoneEventRing() const { return ZoneEventRing; }
 
 	/** A delegate that is fired when the source is destroyed */
 	FLiveLinkAugmentaSourceDestroyedEvent OnLiveLinkAugmentaSourceDestroyed;
@@ -123,9 +147,19 @@ public:
 	// Get the Augmenta Video Output
 	FLiveLinkAugmentaVideoOutput GetAugmentaVideoOutput();
 
-private:
+	/**
+	*  Replace the zones evaluated on the receiving thread. Can be called from any thread.
+	*  Zone coordinates are in Unreal units, in the same space as the objects Position.
+	*/
+	void SetZones(const TArray<FLiveLinkAugmentaZone>& Zones);
+
+	// Latest state of each object, can be read from any thread
+	const FLiveLinkAugmentaObjectStateSlots& GetObjectStateSlots() const { return ObjectStateSlots; }
 
-	void Send(FLiveLinkFrameDataStruct* FrameDataToSend, FName SubjectName);
+	// Last complete frames, only filled when bBufferFrames is set in the source settings. Can be read from any thread.
+	const FLiveLinkAugmentaFrameBuffer& GetFrameBuffer() const { return FrameBuffer; }
+
+	bool IsBufferingFrames() const { return bBufferFrames; }
 
 private:
 	ILiveLinkClient* Client;
@@ -158,8 +192,8 @@ private:
 	// Receive buffer for UDP socket
 	TArray<uint8> ReceiveBuffer;
 
-	// List of subjects we've already encountered
-	TSet<FName> EncounteredSubjects;
+	// Pushes the Live Link subjects, only used on the receiving thread
+	FLiveLinkAugmentaSubjectPusher SubjectPusher;
 
 	// Deferred start delegate handle
 	FDelegateHandle DeferredStartDelegateHandle;
@@ -176,6 +210,9 @@ private:
 	// Maximum inactive time before a point is removed
 	float TimeoutDuration;
 
+	// Maximum time to wait for the extra message of an object before publishing its base message alone
+	float ObjectExtraWaitTime = 0.01f;
+
 	// Offset object position vertically according to its height
 	bool bApplyObjectHeight;
 
@@ -188,6 +225,9 @@ private:
 	// Disable the creation and update of Live Link subjects from received Augmenta data
 	bool bDisableSubjectsUpdate;
 
+	// Keep the last complete frames in the frame buffer
+	bool bBufferFrames = false;
+
 	// Augmenta scene parameters
 	FName SceneName;
 	FLiveLinkAugmentaScene AugmentaScene;
@@ -195,18 +235,59 @@ private:
 	// Augmenta objects
 	TMap<int, FLiveLinkAugmentaObject> AugmentaObjects;
 
+	// Object messages waiting for their base or extra message, by object Id. Entries are kept between frames and removed after TimeoutDuration.
+	TMap<int, FAugmentaPendingObjectMessage> PendingObjectMessages;
+
+	// Whether an extra message was received, base messages are published immediately until then
+	bool bHasReceivedObjectExtra = false;
+
 	// Augmenta video output
 	FLiveLinkAugmentaVideoOutput AugmentaVideoOutput;
 
+	// Incremented by each /fusion message
+	uint32 VideoOutputRevision = 0;
+
+	// Whether a /scene message was received, so that the objects received since then form a complete frame
+	bool bHasReceivedScene = false;
+
+	// Last complete frames, written on the receiving thread
+	FLiveLinkAugmentaFrameBuffer FrameBuffer;
+
+	// Latest state of each object, written on the receiving thread
+	FLiveLinkAugmentaObjectStateSlots ObjectStateSlots;
+
+	// Events written on the receiving thread
+	TLiveLinkAugmentaEventRing<FAugmentaEventData> EventRing;
+	TLiveLinkAugmentaEventRing<FAugmentaEventData> UpdateEventRing;
+	TLiveLinkAugmentaEventRing<FLiveLinkAugmentaZoneEvent> ZoneEventRing;
+
+	void PublishEvent(int EventType, const FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Spatial index over the objects, only used on the receiving thread
+	FLiveLinkAugmentaSpatialIndex SpatialIndex;
+
+	// Zones evaluated on the receiving thread
+	FLiveLinkAugmentaZoneEngine ZoneEngine;
+
+	// Zone events generated by the last zone evaluation
+	TArray<FLiveLinkAugmentaZoneEvent> ZoneEvents;
+
+	// Whether objects moved since the last zone evaluation
+	FThreadSafeBool bZonesNeedEvaluation = false;
+
 	// OSC Parsing
 	void HandleOSCPacket(const OSCPP::Server::Packet& Packet);
 	void ReadAugmentaObjectFromOSC(FLiveLinkAugmentaObject* AugmentaObject, OSCPP::Server::ArgStream* Args);
-	void UpdateAugmentaObjectExtraFromOSC(OSCPP::Server::ArgStream* Args);
+	void ReceiveAugmentaObjectFromOSC(int EventType, OSCPP::Server::ArgStream* Args);
+	void ReceiveAugmentaObjectExtraFromOSC(OSCPP::Server::ArgStream* Args);
+	void CommitAugmentaObject(int EventType, FLiveLinkAugmentaObject& AugmentaObject, bool bHasExtra);
+	bool FlushPendingObjectMessages(double MaxReceiveTime);
 	void AddAugmentaObject(FLiveLinkAugmentaObject AugmentaObject);
-	void UpdateAugmentaObject(FLiveLinkAugmentaObject AugmentaObject);
+	void UpdateAugmentaObject(FLiveLinkAugmentaObject& ExistingObject, const FLiveLinkAugmentaObject& AugmentaObject);
 	void RemoveAugmentaObject(FLiveLinkAugmentaObject AugmentaObject);
 	void UpdateAugmentaObjectSubject(FLiveLinkAugmentaObject AugmentaObject);
 	void RemoveInactiveObjects();
+	void EvaluateZones();
 
 	TArray<int> ObjectsToRemove;
 
@@ -0,0 +1,50 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Forward Declarations */
+class FLiveLinkAugmentaSource;
+
+/** Delegates */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FLiveLinkAugmentaSourceRegistryEvent, FName /*SceneName*/, FLiveLinkAugmentaSource* /*Source*/);
+
+/**
+ * Global registry of the Augmenta Live Link sources, keyed by scene name.
+ * Sources register themselves once their settings are initialized and unregister when destroyed,
+ * so managers can attach as soon as a source comes up instead of polling the Live Link client.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaSourceRegistry
+{
+public:
+
+	static FLiveLinkAugmentaSourceRegistry& Get();
+
+	// Register a source under its scene name. The last source registered under a name is the one used, the others are kept in case it goes away.
+	void RegisterSource(FLiveLinkAugmentaSource* Source);
+
+	// Unregister a source. When it was the one used for its scene name, the previous source still registered under that name is used again.
+	void UnregisterSource(FLiveLinkAugmentaSource* Source);
+
+	// Get the source used for a scene name, nullptr if none. Should be called from the game thread.
+	FLiveLinkAugmentaSource* FindSource(FName SceneName) const;
+
+	// Fired on the game thread when a source becomes the one used for its scene name
+	FLiveLinkAugmentaSourceRegistryEvent OnSourceRegistered;
+
+	// Fired when the source used for a scene name is unregistered, before it is destroyed
+	FLiveLinkAugmentaSourceRegistryEvent OnSourceUnregistered;
+
+private:
+
+	// Broadcast OnSourceRegistered on the game thread
+	void NotifySourceRegistered(FName SceneName);
+
+	void BroadcastSourceRegistered(FName SceneName);
+
+	mutable FCriticalSection SourcesCriticalSection;
+
+	// Sources registered under each scene name, the last one is used
+	TMap<FName, TArray<FLiveLinkAugmentaSource*>> Sources;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "LiveLinkSourceSettings.h"
+#include "LiveLinkAugmentaZoneEngine.h"
 #include "LiveLinkAugmentaSourceSettings.generated.h"
 
 class FLiveLinkAugmentaSource;
@@ -23,6 +24,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Augmenta|Augmenta Objects")
 	float TimeoutDuration = 1;
 
+	/** Time to wait for the extra message of an object (/object/update/extra) before publishing its base message alone. The base and extra messages of a frame are published as a single update. 0 publishes the base messages immediately and applies the extra data without event. */
+	UPROPERTY(EditAnywhere, Category = "Augmenta|Augmenta Objects", meta = (ClampMin = "0.0"))
+	float ObjectExtraWaitTime = 0.01f;
+
 	/** Use bounding box size as object scale. */
 	UPROPERTY(EditAnywhere, Category = "Augmenta|Augmenta Objects")
 	bool bApplyObjectScale = true;
@@ -39,6 +44,14 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Augmenta|Optimization")
 	bool bDisableSubjectsUpdate = false;
 
+	/** Keep the last complete Augmenta frames, so that nDisplay nodes receiving the same stream can apply the same frame. Required by the local ingest replication mode of the Augmenta Cluster Manager. */
+	UPROPERTY(EditAnywhere, Category = "Augmenta|Cluster")
+	bool bBufferFrames = false;
+
+	/** Zones evaluated on the receiving thread. Only zone enter, leave and occupancy events are sent to the game thread. */
+	UPROPERTY(EditAnywhere, Category = "Augmenta|Zones")
+	TArray<FLiveLinkAugmentaZone> Zones;
+
 	/** Live Link source reference */
 	FLiveLinkAugmentaSource* SourceReference;
 };
@@ -0,0 +1,137 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Sparse uniform grid over the ground positions of Augmenta objects.
+ * Positions are in Unreal units in the horizontal (X, Y) plane, i.e. the X and Y of FLiveLinkAugmentaObject::Position.
+ * Updates are incremental (O(1) per enter, update or leave) and queries only visit the cells they overlap.
+ * This class is not thread safe, each thread should own its own index.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaSpatialIndex
+{
+public:
+
+	explicit FLiveLinkAugmentaSpatialIndex(float InCellSize = 100.0f);
+
+	// Set the grid cell size (in Unreal units). Existing objects are re-inserted.
+	void SetCellSize(float InCellSize);
+
+	float GetCellSize() const { return CellSize; }
+
+	// Insert a new object or move an existing one
+	void Update(int Id, const FVector2D& Position);
+
+	// Remove an object, does nothing if the object is not in the index
+	void Remove(int Id);
+
+	// Remove all objects
+	void Reset();
+
+	int Num() const { return Entries.Num(); }
+
+	bool Contains(int Id) const { return Entries.Contains(Id); }
+
+	/**
+	*  Get the indexed position of an object
+	*  @return FALSE if the object is not in the index
+	*/
+	bool GetPosition(int Id, FVector2D& OutPosition) const;
+
+	/**
+	*  Get the objects within a radius of a point. Results are appended to OutIds in no particular order.
+	*/
+	void QueryRadius(const FVector2D& Center, double Radius, TArray<int>& OutIds) const;
+
+	/**
+	*  Get the objects inside an oriented rectangle. Results are appended to OutIds in no particular order.
+	*  @param  Center				Center of the rectangle
+	*  @param  HalfExtents			Half size of the rectangle along its local axes
+	*  @param  RotationDegrees		Rotation of the rectangle around the vertical axis (Unreal yaw)
+	*/
+	void QueryOrientedRect(const FVector2D& Center, const FVector2D& HalfExtents, double RotationDegrees, TArray<int>& OutIds) const;
+
+	/**
+	*  Get the Count nearest objects to a point, sorted from nearest to farthest. Results are appended to OutIds.
+	*  @param  MaxDistance			Objects farther than this distance are ignored
+	*/
+	void QueryNearest(const FVector2D& Point, int Count, TArray<int>& OutIds, double MaxDistance = UE_BIG_NUMBER) const;
+
+	/**
+	*  Get the nearest object to a point
+	*  @return The object Id, or INDEX_NONE if no object is within MaxDistance
+	*/
+	int FindNearest(const FVector2D& Point, double MaxDistance = UE_BIG_NUMBER) const;
+
+	/**
+	*  Call Func(Id, Position) for every object in the cells overlapping Box.
+	*  Objects may lie slightly outside Box, callers are expected to do their own exact test.
+	*/
+	template<typename FuncType>
+	void ForEachCandidateInBox(const FBox2D& Box, FuncType&& Func) const
+	{
+		const FIntPoint MinCell = GetCell(Box.Min);
+		const FIntPoint MaxCell = GetCell(Box.Max);
+
+		// Fall back to a full scan when the box covers more cells than there are occupied ones
+		const int64 BoxCellCount = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+		if (BoxCellCount > Cells.Num())
+		{
+			for (const TPair<FIntPoint, TArray<FCellItem>>& Cell : Cells)
+			{
+				if (Cell.Key.X < MinCell.X || Cell.Key.X > MaxCell.X || Cell.Key.Y < MinCell.Y || Cell.Key.Y > MaxCell.Y)
+				{
+					continue;
+				}
+				for (const FCellItem& Item : Cell.Value)
+				{
+					Func(Item.Id, Item.Position);
+				}
+			}
+			return;
+		}
+
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+			{
+				if (const TArray<FCellItem>* Cell = Cells.Find(FIntPoint(X, Y)))
+				{
+					for (const FCellItem& Item : *Cell)
+					{
+						Func(Item.Id, Item.Position);
+					}
+				}
+			}
+		}
+	}
+
+private:
+
+	struct FCellItem
+	{
+		int Id;
+		FVector2D Position;
+	};
+
+	struct FEntry
+	{
+		FIntPoint Cell;
+		int32 IndexInCell;
+	};
+
+	FIntPoint GetCell(const FVector2D& Position) const;
+
+	void RemoveFromCell(const FEntry& Entry);
+
+	float CellSize;
+	double InvCellSize;
+
+	// Object Id -> location in the grid
+	TMap<int, FEntry> Entries;
+
+	// Grid cell -> objects in the cell. Only cells holding objects are kept.
+	TMap<FIntPoint, TArray<FCellItem>> Cells;
+};
@@ -0,0 +1,48 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkAugmentaData.h"
+
+class ILiveLinkClient;
+
+/**
+ * Pushes the Augmenta scene, video output and objects to a Live Link client as transform subjects named
+ * <SceneName>_Scene, <SceneName>_VideoOutput and <SceneName>_Object_<Oid>.
+ * Shared by the sources receiving the Augmenta stream and the sources fed by the cluster, so that both create the same subjects.
+ * Must always be called from the same thread.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaSubjectPusher
+{
+public:
+
+	void Initialize(ILiveLinkClient* InClient, FGuid InSourceGuid, FName InSceneName);
+
+	void PushScene(const FLiveLinkAugmentaScene& AugmentaScene);
+	void PushVideoOutput(const FLiveLinkAugmentaVideoOutput& AugmentaVideoOutput);
+	void PushObject(const FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Remove the subject of an object, does nothing if it was never pushed
+	void RemoveObject(const FLiveLinkAugmentaObject& AugmentaObject);
+
+	// Remove the subjects of all the objects
+	void RemoveObjects();
+
+private:
+
+	FName GetObjectSubjectName(const FLiveLinkAugmentaObject& AugmentaObject) const;
+
+	void PushTransform(FName SubjectName, const FTransform& Transform);
+
+	ILiveLinkClient* Client = nullptr;
+
+	FGuid SourceGuid;
+
+	FName SceneName;
+	FName SceneSubjectName;
+	FName VideoOutputSubjectName;
+
+	// List of subjects we've already encountered
+	TSet<FName> EncounteredSubjects;
+};
@@ -0,0 +1,53 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "LiveLinkAugmentaEventCoalescer.h"
+#include "LiveLinkAugmentaZoneEngine.h"
+
+#include "CoreMinimal.h"
+#include "LiveLinkAugmentaSubscription.generated.h"
+
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EAugmentaObjectEventType : uint8
+{
+	None = 0 UMETA(Hidden),
+	Entered = 1 << 0,
+	Updated = 1 << 1,
+	Left = 1 << 2
+};
+ENUM_CLASS_FLAGS(EAugmentaObjectEventType);
+
+static_assert((uint8)EAugmentaObjectEventType::Entered == (uint8)EAugmentaLifecycleFlags::Entered
+	&& (uint8)EAugmentaObjectEventType::Updated == (uint8)EAugmentaLifecycleFlags::Updated
+	&& (uint8)EAugmentaObjectEventType::Left == (uint8)EAugmentaLifecycleFlags::Left,
+	"EAugmentaObjectEventType must match EAugmentaLifecycleFlags");
+
+/**
+ * Filters of an Augmenta event subscription, evaluated once per frame.
+ */
+USTRUCT(BlueprintType, Category = "Augmenta|Subscriptions")
+struct LIVELINKAUGMENTA_API FLiveLinkAugmentaSubscriptionFilter
+{
+	GENERATED_BODY()
+
+	/** The object events to receive. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Subscription", meta = (Bitmask, BitmaskEnum = "/Script/LiveLinkAugmenta.EAugmentaObjectEventType"))
+	int32 EventTypes = (int32)(EAugmentaObjectEventType::Entered | EAugmentaObjectEventType::Updated | EAugmentaObjectEventType::Left);
+
+	/** Only receive the events of objects inside the zone. An object moving into the zone is received as entered, and as left when it moves out of it. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Subscription")
+	bool bFilterByZone = false;
+
+	/** The zone objects must be in. The zone name is ignored. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Subscription", meta = (EditCondition = "bFilterByZone"))
+	FLiveLinkAugmentaZone Zone;
+
+	/** Maximum rate (in Hz) of the object updates, the latest state of each object is sent at this rate. Zero or less means no limit. Enter and leave events are never delayed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Subscription", meta = (ClampMin = "0.0"))
+	float MaxUpdateRate = 0;
+
+	bool AcceptsEvent(EAugmentaLifecycleFlags Event) const { return (EventTypes & (int32)Event) != 0; }
+
+	bool AcceptsObject(const FLiveLinkAugmentaObject& AugmentaObject) const { return !bFilterByZone || Zone.Contains(FVector2D(AugmentaObject.Position)); }
+};
@@ -0,0 +1,118 @@
+// Copyright Augmenta 2023, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkAugmentaSpatialIndex.h"
+#include "LiveLinkAugmentaZoneEngine.generated.h"
+
+UENUM(BlueprintType)
+enum class EAugmentaZoneShape : uint8
+{
+	Polygon,
+	Circle
+};
+
+/**
+ * A floor zone evaluated against the Augmenta objects positions.
+ * Coordinates are in Unreal units in the horizontal plane, i.e. the same space as the X and Y of the object Position.
+ */
+USTRUCT(BlueprintType, Category = "Augmenta|Zones")
+struct LIVELINKAUGMENTA_API FLiveLinkAugmentaZone
+{
+	GENERATED_BODY()
+
+	/** The zone name, used to identify the zone in zone events. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Zone")
+	FName Name;
+
+	/** The zone shape. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Zone")
+	EAugmentaZoneShape Shape = EAugmentaZoneShape::Polygon;
+
+	/** The polygon vertices, in order. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Zone", meta = (EditCondition = "Shape == EAugmentaZoneShape::Polygon", EditConditionHides))
+	TArray<FVector2D> Points;
+
+	/** The circle center. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Zone", meta = (EditCondition = "Shape == EAugmentaZoneShape::Circle", EditConditionHides))
+	FVector2D Center = FVector2D::ZeroVector;
+
+	/** The circle radius. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Augmenta|Zone", meta = (EditCondition = "Shape == EAugmentaZoneShape::Circle", EditConditionHides, ClampMin = "0.0"))
+	float Radius = 100.0f;
+
+	// Whether a point lies inside the zone
+	bool Contains(const FVector2D& Point) const;
+
+	// The axis aligned bounds of the zone
+	FBox2D GetBounds() const;
+};
+
+UENUM(BlueprintType)
+enum class EAugmentaZoneEventType : uint8
+{
+	Enter,
+	Leave,
+	OccupancyChanged
+};
+
+/**
+ * A zone event generated by the zone engine.
+ */
+USTRUCT(BlueprintType, Category = "Augmenta|Zones")
+struct LIVELINKAUGMENTA_API FLiveLinkAugmentaZoneEvent
+{
+	GENERATED_BODY()
+
+	/** The event type. */
+	UPROPERTY(BlueprintReadWrite, Category = "Augmenta|Zone Event")
+	EAugmentaZoneEventType Type = EAugmentaZoneEventType::Enter;
+
+	/** The name of the zone. */
+	UPROPERTY(BlueprintReadWrite, Category = "Augmenta|Zone Event")
+	FName ZoneName;
+
+	/** The Id of the object entering or leaving the zone. -1 for occupancy events. */
+	UPROPERTY(BlueprintReadWrite, Category = "Augmenta|Zone Event")
+	int ObjectId = -1;
+
+	/** The number of objects in the zone after this event. */
+	UPROPERTY(BlueprintReadWrite, Category = "Augmenta|Zone Event")
+	int Occupancy = 0;
+};
+
+/**
+ * Tracks which objects are inside which zones and generates enter, leave and occupancy events.
+ * Evaluate is meant to be called from the receiving thread, SetZones can be called from any thread.
+ */
+class LIVELINKAUGMENTA_API FLiveLinkAugmentaZoneEngine
+{
+public:
+
+	// Replace the evaluated zones. Zones keeping the same name keep their occupants.
+	void SetZones(const TArray<FLiveLinkAugmentaZone>& InZones);
+
+	bool HasZones() const;
+
+	// Evaluate all zones against the index and append the generated events to OutEvents
+	void Evaluate(const FLiveLinkAugmentaSpatialIndex& SpatialIndex, TArray<FLiveLinkAugmentaZoneEvent>& OutEvents);
+
+private:
+
+	struct FZoneState
+	{
+		FLiveLinkAugmentaZone Zone;
+		FBox2D Bounds;
+
+		// Sorted Ids of the objects inside the zone
+		TArray<int> Occupants;
+	};
+
+	mutable FCriticalSection ZonesCriticalSection;
+
+	TArray<FZoneState> Zones;
+
+	// Reused between evaluations to avoid allocations
+	TArray<int> NewOccupants;
+};